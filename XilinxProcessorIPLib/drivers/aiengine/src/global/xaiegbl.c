@@ -25,6 +25,9 @@
 * 1.5  Jubaer  05/24/2019  Add PL type on TileType attribute
 * 1.6  Nishad  07/31/2019  Add support for RPU baremetal
 * 1.7  Wendy   01/20/2020  Add tiles pointer to AIE instance
+* 1.8  agt     10/18/2026  Initialize the tiles in one pass in storage order,
+*                          add XAieGbl_ResetArray() and
+*                          XAieGbl_ClearArrayMems()
 * </pre>
 *
 ******************************************************************************/
@@ -32,7 +35,10 @@
 /***************************** Include Files *********************************/
 #include "xaiegbl_defs.h"
 #include "xaiegbl.h"
+#include "xaiegbl_reginit.h"
+#include "xaielib_npi.h"
 #include "xaietile_event.h"
+#include "xaietile_shim.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -86,6 +92,7 @@ void XAieGbl_CfgInitialize(XAieGbl *InstancePtr, XAieGbl_Tile *TileInstPtr,
 {
 	u16 RowIdx;
 	u16 ColIdx;
+	u64 ColAddr;
 	u64 TileAddr;
 
 	XAieGbl_Tile *TilePtr;
@@ -104,32 +111,72 @@ void XAieGbl_CfgInitialize(XAieGbl *InstancePtr, XAieGbl_Tile *TileInstPtr,
 ConfigPtr->ArrOffset = XAIE_BASE_ARRAY_ADDR_OFFSET;
 #endif
 
-		/* Row index starts with 1 as row-0 is for shim */
-		for(RowIdx = 1; RowIdx <= ConfigPtr->NumRows; RowIdx++) {
+		/*
+		 * The tiles are stored column by column with the shim tile
+		 * first, so walk them in that order.
+		 */
+		TilePtr = TileInstPtr;
+		for(ColIdx=0; ColIdx < ConfigPtr->NumCols; ColIdx++) {
 
-			for(ColIdx=0; ColIdx < ConfigPtr->NumCols; ColIdx++) {
+			/*
+			 * Tile address format:
+			 * --------------------------------------------
+			 * |                7 bits  5 bits   18 bits  |
+			 * --------------------------------------------
+			 * | Array offset | Column | Row | Tile addr  |
+			 * --------------------------------------------
+			 */
+			ColAddr = (u64)(((u64)ConfigPtr->ArrOffset <<
+					XAIEGBL_TILE_ADDR_ARR_SHIFT) |
+					((u64)ColIdx << XAIEGBL_TILE_ADDR_COL_SHIFT));
 
-				TilePtr = (XAieGbl_Tile *)((char *)TileInstPtr +
-                                        ((ColIdx * (ConfigPtr->NumRows + 1)) *
-                                        sizeof(XAieGbl_Tile)) +
-                                        (RowIdx * sizeof(XAieGbl_Tile)));
+			/* Shim tile of the column */
+			TilePtr->RowId = 0U; /* Row index */
+			TilePtr->ColId = ColIdx; /* Column index */
+			TilePtr->TileAddr = ColAddr;
+			TilePtr->MemModAddr = 0U;
+			TilePtr->CoreModAddr = 0U;
 
-				TilePtr->RowId = RowIdx; /* Row index */
-				TilePtr->ColId = ColIdx; /* Column index */
+			/* Set Noc module base address for tile */
+			TilePtr->NocModAddr = ColAddr +
+						XAIEGBL_TILE_ADDR_NOCMODOFF;
+			/* Set PL module base address for tile */
+			TilePtr->PlModAddr = ColAddr +
+						XAIEGBL_TILE_ADDR_PLMODOFF;
 
-				/*
-				 * Tile address format:
-				 * --------------------------------------------
-				 * |                7 bits  5 bits   18 bits  |
-				 * --------------------------------------------
-				 * | Array offset | Column | Row | Tile addr  |
-				 * --------------------------------------------
-				 */
-				TileAddr = (u64)(((u64)ConfigPtr->ArrOffset <<
-						XAIEGBL_TILE_ADDR_ARR_SHIFT) |
-					(ColIdx << XAIEGBL_TILE_ADDR_COL_SHIFT) |
-					(RowIdx << XAIEGBL_TILE_ADDR_ROW_SHIFT));
+			/* Set locks base address in NoC module */
+			TilePtr->LockAddr = TilePtr->NocModAddr +
+						XAIEGBL_TILE_ADDR_NOCLOCKOFF;
 
+			/* Set Stream SW base address in PL module */
+			TilePtr->StrmSwAddr = TilePtr->PlModAddr +
+						XAIEGBL_TILE_ADDR_PLSTRMOFF;
+
+			switch (ColIdx % 4) {
+			case 0:
+			case 1:
+				TilePtr->TileType = XAIEGBL_TILE_TYPE_SHIMPL;
+				break;
+			default:
+				TilePtr->TileType = XAIEGBL_TILE_TYPE_SHIMNOC;
+				break;
+			}
+
+			TilePtr->IsReady = XAIE_COMPONENT_IS_READY;
+
+			XAie_print("Tile addr:%016lx, Row idx:%d, Col idx:%d, "
+				"Nocmodaddr:%016lx, Plmodaddr:%016lx\n",
+				ColAddr, 0U, ColIdx, TilePtr->NocModAddr,
+				TilePtr->PlModAddr);
+			TilePtr++;
+
+			/* Row index starts with 1 as row-0 is for shim */
+			TileAddr = ColAddr;
+			for(RowIdx = 1; RowIdx <= ConfigPtr->NumRows; RowIdx++) {
+				TileAddr += (u64)1U << XAIEGBL_TILE_ADDR_ROW_SHIFT;
+
+				TilePtr->RowId = RowIdx; /* Row index */
+				TilePtr->ColId = ColIdx; /* Column index */
 				TilePtr->TileAddr = TileAddr;
 
 				/* Set memory module base address for tile */
@@ -162,62 +209,97 @@ ConfigPtr->ArrOffset = XAIE_BASE_ARRAY_ADDR_OFFSET;
 					"Coremodaddr:%016lx\n",TileAddr,RowIdx,
 					ColIdx, TilePtr->MemModAddr,
 					TilePtr->CoreModAddr);
+				TilePtr++;
 			}
 		}
+		XAie_print("Initialize events handlers.\n");
+		XAieTile_EventsSetupDefaultHandlers(InstancePtr);
+	}
+}
 
-		/* Initialize the Shim tiles here */
-		for(ColIdx=0; ColIdx < ConfigPtr->NumCols; ColIdx++) {
-
-                        TilePtr = (XAieGbl_Tile *)((char *)TileInstPtr +
-                                        ((ColIdx * (ConfigPtr->NumRows + 1)) *
-                                        sizeof(XAieGbl_Tile)));
-
-			TilePtr->RowId = 0U; /* Row index */
-			TilePtr->ColId = ColIdx; /* Column index */
+/*****************************************************************************/
+/**
+*
+* This API resets the shim of all the columns of the AIE array. The column
+* resets are asserted for all the columns before the shim reset is pulsed
+* from NPI, so the whole array goes through a single reset.
+*
+* @param	InstancePtr - Global AIE instance structure.
+*
+* @return	XAIE_SUCCESS on success.
+*
+* @note		NPI should be accessible.
+*
+******************************************************************************/
+u8 XAieGbl_ResetArray(XAieGbl *InstancePtr)
+{
+	XAieGbl_Tile *TilePtr;
+	u16 ColIdx;
+	u16 TilesPerCol;
 
-			TileAddr = (u64)(((u64)ConfigPtr->ArrOffset <<
-					XAIEGBL_TILE_ADDR_ARR_SHIFT) |
-					(ColIdx << XAIEGBL_TILE_ADDR_COL_SHIFT));
+	XAie_AssertNonvoid(InstancePtr != XAIE_NULL);
+	XAie_AssertNonvoid(InstancePtr->IsReady == XAIE_COMPONENT_IS_READY);
 
-			TilePtr->TileAddr = TileAddr;
-			TilePtr->MemModAddr = 0U;
-			TilePtr->CoreModAddr = 0U;
+	TilesPerCol = InstancePtr->Config->NumRows + 1U;
 
-			/* Set Noc module base address for tile */
-			TilePtr->NocModAddr = TileAddr +
-						XAIEGBL_TILE_ADDR_NOCMODOFF;
-			/* Set PL module base address for tile */
-			TilePtr->PlModAddr = TileAddr +
-						XAIEGBL_TILE_ADDR_PLMODOFF;
+	TilePtr = InstancePtr->Tiles;
+	for (ColIdx = 0U; ColIdx < InstancePtr->Config->NumCols; ColIdx++) {
+		XAieTile_ShimColumnReset(TilePtr, XAIE_RESETENABLE);
+		TilePtr += TilesPerCol;
+	}
 
-			/* Set locks base address in NoC module */
-			TilePtr->LockAddr = TilePtr->NocModAddr +
-						XAIEGBL_TILE_ADDR_NOCLOCKOFF;
+	XAieLib_NpiShimReset(XAIE_RESETENABLE);
+	XAieLib_NpiShimReset(XAIE_RESETDISABLE);
 
-			/* Set Stream SW base address in PL module */
-			TilePtr->StrmSwAddr = TilePtr->PlModAddr +
-						XAIEGBL_TILE_ADDR_PLSTRMOFF;
+	TilePtr = InstancePtr->Tiles;
+	for (ColIdx = 0U; ColIdx < InstancePtr->Config->NumCols; ColIdx++) {
+		XAieTile_ShimColumnReset(TilePtr, XAIE_RESETDISABLE);
+		TilePtr += TilesPerCol;
+	}
 
-			switch (ColIdx % 4) {
-			case 0:
-			case 1:
-				TilePtr->TileType = XAIEGBL_TILE_TYPE_SHIMPL;
-				break;
-			default:
-				TilePtr->TileType = XAIEGBL_TILE_TYPE_SHIMNOC;
-				break;
-			}
+	return XAIE_SUCCESS;
+}
 
-			TilePtr->IsReady = XAIE_COMPONENT_IS_READY;
+/*****************************************************************************/
+/**
+*
+* This API zeroes the data and program memories of all the AIE tiles. Each
+* memory is cleared with one block write.
+*
+* @param	InstancePtr - Global AIE instance structure.
+*
+* @return	XAIE_SUCCESS on success.
+*
+* @note		The cores should be disabled, and the tiles should not be
+*		clock gated, ex, call this before XAiePm_RequestTiles().
+*
+******************************************************************************/
+u8 XAieGbl_ClearArrayMems(XAieGbl *InstancePtr)
+{
+	XAieGbl_Tile *TilePtr;
+	u16 ColIdx;
+	u16 RowIdx;
 
-			XAie_print("Tile addr:%016lx, Row idx:%d, Col idx:%d, "
-				"Nocmodaddr:%016lx, Plmodaddr:%016lx\n",
-				TileAddr, 0U, ColIdx, TilePtr->NocModAddr,
-				TilePtr->PlModAddr);
+	XAie_AssertNonvoid(InstancePtr != XAIE_NULL);
+	XAie_AssertNonvoid(InstancePtr->IsReady == XAIE_COMPONENT_IS_READY);
+
+	TilePtr = InstancePtr->Tiles;
+	for (ColIdx = 0U; ColIdx < InstancePtr->Config->NumCols; ColIdx++) {
+		/* Skip the shim tile */
+		TilePtr++;
+		for (RowIdx = 1U; RowIdx <= InstancePtr->Config->NumRows;
+				RowIdx++) {
+			XAieGbl_ZeroBlock32(TilePtr->TileAddr +
+					XAIEGBL_TILE_DATAMEM_BASE,
+					XAIEGBL_TILE_DATAMEM_SIZE / 4U);
+			XAieGbl_ZeroBlock32(TilePtr->TileAddr +
+					XAIEGBL_TILE_PROGMEM_BASE,
+					XAIEGBL_TILE_PROGMEM_SIZE / 4U);
+			TilePtr++;
 		}
-		XAie_print("Initialize events handlers.\n");
-		XAieTile_EventsSetupDefaultHandlers(InstancePtr);
 	}
+
+	return XAIE_SUCCESS;
 }
 
 /*****************************************************************************/
@@ -89,6 +89,7 @@
 * 1.6  Wendy   01/10/2020  Add tile location type
 * 1.7  Wendy   01/20/2020  Add events handlers for each events
 * 1.7  Wendy   02/24/2020  Add errors handlers for each error
+* 1.8  agt     10/18/2026  Add array reset and memory clear APIs
 * </pre>
 *
 ******************************************************************************/
@@ -124,6 +125,9 @@
 
 #define XAIEGBL_TILE_LOCK_NUM_MAX	        16U
 
+#define XAIEGBL_TILE_DATAMEM_SIZE	        0x8000U
+#define XAIEGBL_TILE_PROGMEM_SIZE	        0x4000U
+
 #define XAIEGBL_TILE_PLIF_AIE2PL_MAX_STRMS	6U
 #define XAIEGBL_TILE_PLIF_AIE2PL_MAX_STRMS128	3U
 #define XAIEGBL_TILE_PLIF_PL2AIE_MAX_STRMS	8U
@@ -312,6 +316,8 @@ typedef struct {
 void XAieGbl_HwInit(XAieGbl_HwCfg *CfgPtr);
 void XAieGbl_CfgInitialize(XAieGbl *InstancePtr, XAieGbl_Tile *TileInstPtr, XAieGbl_Config *ConfigPtr);
 XAieGbl_Config *XAieGbl_LookupConfig(u16 DeviceId);
+u8 XAieGbl_ResetArray(XAieGbl *InstancePtr);
+u8 XAieGbl_ClearArrayMems(XAieGbl *InstancePtr);
 
 #endif            /* end of protection macro */
 /** @} */
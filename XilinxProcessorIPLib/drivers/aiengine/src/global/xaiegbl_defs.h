@@ -22,6 +22,9 @@
 * 1.3  Nishad  12/05/2018  Renamed ME attributes to AIE
 * 1.4  Hyun    01/08/2019  Add the mask poll function
 * 1.5  Tejus   10/14/2019  Enable assertion for linux and simulation
+* 1.6  agt     10/18/2026  Add the transaction functions
+* 1.7  agt     10/18/2026  Add the block zero function
+* 1.8  agt     10/18/2026  Add the block write and read functions
 * </pre>
 *
 ******************************************************************************/
@@ -61,9 +64,18 @@
 #define XAieGbl_Write128                 XAieLib_Write128
 #define XAieGbl_WriteCmd                 XAieLib_WriteCmd
 #define XAieGbl_MaskPoll                 XAieLib_MaskPoll
+#define XAieGbl_WriteBlock32             XAieLib_WriteBlock32
+#define XAieGbl_ReadBlock32              XAieLib_ReadBlock32
+#define XAieGbl_ZeroBlock32              XAieLib_ZeroBlock32
 #define XAieGbl_LoadElf                  XAieLib_LoadElf
 #define XAieGbl_LoadElfMem               XAieLib_LoadElfMem
 
+#define XAieGbl_TxnStart                 XAieLib_TxnStart
+#define XAieGbl_TxnFlush                 XAieLib_TxnFlush
+#define XAieGbl_TxnEnd                   XAieLib_TxnEnd
+#define XAieGbl_TxnIsActive              XAieLib_TxnIsActive
+#define XAieGbl_TxnApply                 XAieLib_TxnApply
+
 #define XAieGbl_NPIRead32                XAieLib_NPIRead32
 #define XAieGbl_NPIWrite32               XAieLib_NPIWrite32
 #define XAieGbl_NPIMaskWrite32           XAieLib_NPIMaskWrite32
@@ -20,6 +20,9 @@
 * 1.0  Hyun    07/12/2018  Initial creation
 * 1.1  Hyun    10/11/2018  Initialize the IO device for mem instance
 * 1.2  Nishad  12/05/2018  Renamed ME attributes to AIE
+* 1.3  agt     10/18/2026  Add XAieIO_WriteBlock32()
+* 1.4  agt     10/18/2026  Add XAieIO_ZeroBlock32()
+* 1.5  agt     10/18/2026  Add XAieIO_ReadBlock32()
 * </pre>
 *
 ******************************************************************************/
@@ -360,6 +363,68 @@ void XAieIO_Write32(u64 Addr, u32 Data)
 	metal_io_write32(IOInst.io, Addr - IOInst.io_base, Data);
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write consecutive 32bit words starting at
+* the specified address.
+*
+* @param	Addr: Address to write to.
+* @param	Data: Pointer to the data to be written.
+* @param	Len: Number of 32bit words to write.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieIO_WriteBlock32(u64 Addr, const u32 *Data, u32 Len)
+{
+	metal_io_block_write(IOInst.io, Addr - IOInst.io_base, Data,
+			     (int)(Len * sizeof(u32)));
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to zero consecutive 32bit words starting at
+* the specified address.
+*
+* @param	Addr: Address to write to.
+* @param	Len: Number of 32bit words to zero.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieIO_ZeroBlock32(u64 Addr, u32 Len)
+{
+	metal_io_block_set(IOInst.io, Addr - IOInst.io_base, 0U,
+			   (int)(Len * sizeof(u32)));
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read consecutive 32bit words starting at
+* the specified address.
+*
+* @param	Addr: Address to read from.
+* @param	Data: Pointer to the buffer to store the read data.
+* @param	Len: Number of 32bit words to read.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieIO_ReadBlock32(u64 Addr, u32 *Data, u32 Len)
+{
+	metal_io_block_read(IOInst.io, Addr - IOInst.io_base, Data,
+			    (int)(Len * sizeof(u32)));
+}
+
 /*****************************************************************************/
 /**
 *
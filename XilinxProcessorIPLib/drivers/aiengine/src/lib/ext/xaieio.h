@@ -19,6 +19,9 @@
 * ----- ------  -------- -----------------------------------------------------
 * 1.0  Hyun    07/12/2018  Initial creation
 * 1.1  Nishad  12/05/2018  Renamed ME attributes to AIE
+* 1.2  agt     10/18/2026  Add XAieIO_WriteBlock32()
+* 1.3  agt     10/18/2026  Add XAieIO_ZeroBlock32()
+* 1.4  agt     10/18/2026  Add XAieIO_ReadBlock32()
 * </pre>
 *
 ******************************************************************************/
@@ -49,6 +52,9 @@ uint32 XAieIO_Read32(uint64_t Addr);
 void XAieIO_Read128(uint64_t Addr, uint32 *Data);
 void XAieIO_Write32(uint64_t Addr, uint32 Data);
 void XAieIO_Write128(uint64_t Addr, uint32 *Data);
+void XAieIO_WriteBlock32(uint64_t Addr, const uint32 *Data, uint32 Len);
+void XAieIO_ZeroBlock32(uint64_t Addr, uint32 Len);
+void XAieIO_ReadBlock32(uint64_t Addr, uint32 *Data, uint32 Len);
 
 typedef struct XAieIO_Mem XAieIO_Mem;
 
@@ -38,6 +38,10 @@
 * 2.6  Tejus   10/14/2019  Enable assertion for linux and simulation
 * 2.7  Wendy   02/25/2020  Add logging API
 * 2.8  Tejus   04/17/2020  Fix variable overflow issue.
+* 2.9  agt     10/18/2026  Add transaction mode recording IO operations into
+*                          a command buffer in the PLM CDO format.
+* 3.0  agt     10/18/2026  Add XAieLib_ZeroBlock32()
+* 3.1  agt     10/18/2026  Add XAieLib_WriteBlock32() and XAieLib_ReadBlock32()
 * </pre>
 *
 ******************************************************************************/
@@ -95,6 +99,30 @@
 /* Address should be aligned at 128 bit / 16 bytes */
 #define XAIELIB_SHIM_MEM_ALIGN		16
 
+/*
+ * Transaction commands are stored as PLM generic module CDO commands:
+ * a header with the payload length in bits 23:16, the module in 15:8 and
+ * the command in 7:0, followed by the payload.
+ */
+#define XAIELIB_TXN_MODULE_GENERIC	0x100U
+#define XAIELIB_TXN_DMA_WRITE		(XAIELIB_TXN_MODULE_GENERIC | 5U)
+#define XAIELIB_TXN_MASK_POLL64		(XAIELIB_TXN_MODULE_GENERIC | 6U)
+#define XAIELIB_TXN_MASK_WRITE64	(XAIELIB_TXN_MODULE_GENERIC | 7U)
+#define XAIELIB_TXN_WRITE64		(XAIELIB_TXN_MODULE_GENERIC | 8U)
+#define XAIELIB_TXN_CMD_MASK		0xFFFFU
+#define XAIELIB_TXN_LEN_LSB		16U
+#define XAIELIB_TXN_LEN_MASK		0xFFU
+/* Length value meaning the payload length is in the next word */
+#define XAIELIB_TXN_LONG_LEN		0xFFU
+
+#define XAIELIB_TXN_WRITE_LEN		3U	/**< Address high, low, data */
+#define XAIELIB_TXN_MASK_WRITE_LEN	4U	/**< Address high, low, mask, data */
+#define XAIELIB_TXN_MASK_POLL_LEN	5U	/**< + expected value, timeout */
+/* Smallest buffer to hold any one command */
+#define XAIELIB_TXN_MIN_SIZE		(XAIELIB_TXN_MASK_POLL_LEN + 1U)
+
+#define XAIELIB_TXN_HDR(Cmd, Len)	((Cmd) | ((Len) << XAIELIB_TXN_LEN_LSB))
+
 /************************** Variable Definitions *****************************/
 typedef struct XAieLib_MemInst
 {
@@ -104,10 +132,26 @@ typedef struct XAieLib_MemInst
 	void *Platform;	/**< Platform specific data */
 } XAieLib_MemInst;
 
+typedef struct XAieLib_Txn
+{
+	u32 *Buf;	/**< Command buffer */
+	u32 Size;	/**< Size of the buffer in words */
+	u32 Len;	/**< Words used in the buffer */
+	u32 LastWrite;	/**< Index of the last write command, or Size if none */
+	u64 NextAddr;	/**< Address following the last write command */
+	u32 Status;	/**< XAIELIB_FAILURE once a flushed command failed */
+	u8 Active;	/**< Non 0 while IO operations are recorded */
+} XAieLib_Txn;
+
 #ifdef __linux__
 static FILE *XAieLib_LogFPtr; /**< Pointer to Log file pointer. */
 #endif
 
+static XAieLib_Txn XAieLib_TxnInst; /**< Transaction being recorded */
+
+static u32 XAieLib_TxnSync(void);
+static void XAieLib_TxnWrite(u64 Addr, const u32 *Data, u32 Cnt);
+
 /************************** Function Definitions *****************************/
 
 /*****************************************************************************/
@@ -172,6 +216,9 @@ void XAieLib_AssertVoid(u8 Cond, const char *func, const u32 line)
 *******************************************************************************/
 int XAieLib_usleep(u64 Usec)
 {
+	/* Delays are for the writes issued before */
+	(void)XAieLib_TxnSync();
+
 #ifdef __AIESIM__
 	return XAieSim_usleep(Usec);
 #else
@@ -879,6 +926,428 @@ u32 XAieLib_MemRead32(XAieLib_MemInst *XAieLib_MemInstPtr, u64 Addr)
 #endif
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write consecutive 32bit words starting at
+* the specified address.
+*
+* @param	Addr: Address to write to.
+* @param	Data: Pointer to the data to be written.
+* @param	Len: Number of 32bit words to write.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieLib_WriteBlock32(u64 Addr, const u32 *Data, u32 Len)
+{
+	if (XAieLib_TxnInst.Active != 0U) {
+		XAieLib_TxnWrite(Addr, Data, Len);
+		return;
+	}
+
+#ifdef __AIESIM__
+	u32 Idx;
+
+	for (Idx = 0U; Idx < Len; Idx++) {
+		XAieSim_Write32(Addr + Idx * 4U, Data[Idx]);
+	}
+#elif defined __AIEBAREMTL__
+	u32 Idx;
+
+	for (Idx = 0U; Idx < Len; Idx++) {
+		Xil_Out32(Addr + Idx * 4U, Data[Idx]);
+	}
+#else
+	XAieIO_WriteBlock32(Addr, Data, Len);
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read consecutive 32bit words starting at
+* the specified address.
+*
+* @param	Addr: Address to read from.
+* @param	Data: Pointer to the buffer to store the read data.
+* @param	Len: Number of 32bit words to read.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieLib_ReadBlock32(u64 Addr, u32 *Data, u32 Len)
+{
+	(void)XAieLib_TxnSync();
+
+#ifdef __AIESIM__
+	u32 Idx;
+
+	for (Idx = 0U; Idx < Len; Idx++) {
+		Data[Idx] = XAieSim_Read32(Addr + Idx * 4U);
+	}
+#elif defined __AIEBAREMTL__
+	u32 Idx;
+
+	for (Idx = 0U; Idx < Len; Idx++) {
+		Data[Idx] = Xil_In32(Addr + Idx * 4U);
+	}
+#else
+	XAieIO_ReadBlock32(Addr, Data, Len);
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to execute the commands of a transaction
+* buffer. Consecutive writes are done as one block write.
+*
+* @param	Buf: Pointer to the commands.
+* @param	Len: Number of words in the buffer.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE if a
+*		command is malformed or a poll times out.
+*
+* @note		Used only in this file. Execution stops at the first
+*		failing command.
+*
+*******************************************************************************/
+static u32 XAieLib_TxnRun(const u32 *Buf, u32 Len)
+{
+	u32 Idx = 0U;
+	u32 Hdr, CmdLen, HdrLen;
+	const u32 *Payload;
+	u64 Addr;
+
+	while (Idx < Len) {
+		Hdr = Buf[Idx];
+		CmdLen = (Hdr >> XAIELIB_TXN_LEN_LSB) & XAIELIB_TXN_LEN_MASK;
+		HdrLen = 1U;
+		if (CmdLen == XAIELIB_TXN_LONG_LEN) {
+			if ((Idx + 1U) >= Len) {
+				return XAIELIB_FAILURE;
+			}
+			CmdLen = Buf[Idx + 1U];
+			HdrLen = 2U;
+		}
+		if ((CmdLen < XAIELIB_TXN_WRITE_LEN) ||
+				(CmdLen > (Len - Idx - HdrLen))) {
+			return XAIELIB_FAILURE;
+		}
+
+		Payload = &Buf[Idx + HdrLen];
+		Addr = ((u64)Payload[0U] << 32U) | Payload[1U];
+
+		switch (Hdr & XAIELIB_TXN_CMD_MASK) {
+		case XAIELIB_TXN_WRITE64:
+		case XAIELIB_TXN_DMA_WRITE:
+			XAieLib_WriteBlock32(Addr, &Payload[2U], CmdLen - 2U);
+			break;
+		case XAIELIB_TXN_MASK_WRITE64:
+			if (CmdLen < XAIELIB_TXN_MASK_WRITE_LEN) {
+				return XAIELIB_FAILURE;
+			}
+			XAieLib_MaskWrite32(Addr, Payload[2U], Payload[3U]);
+			break;
+		case XAIELIB_TXN_MASK_POLL64:
+			if ((CmdLen < XAIELIB_TXN_MASK_POLL_LEN) ||
+					(XAieLib_MaskPoll(Addr, Payload[2U],
+						Payload[3U], Payload[4U]) !=
+					 XAIELIB_SUCCESS)) {
+				return XAIELIB_FAILURE;
+			}
+			break;
+		default:
+			return XAIELIB_FAILURE;
+		}
+
+		Idx += HdrLen + CmdLen;
+	}
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to execute and drop the commands recorded so
+* far. Recording continues at the start of the buffer.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE.
+*
+* @note		Used only in this file. Does nothing if no transaction is
+*		active.
+*
+*******************************************************************************/
+static u32 XAieLib_TxnSync(void)
+{
+	XAieLib_Txn *TxnPtr = &XAieLib_TxnInst;
+	u32 Ret = XAIELIB_SUCCESS;
+
+	if ((TxnPtr->Active == 0U) || (TxnPtr->Len == 0U)) {
+		return XAIELIB_SUCCESS;
+	}
+
+	/* Let the IO functions reach the hardware while executing */
+	TxnPtr->Active = 0U;
+	Ret = XAieLib_TxnRun(TxnPtr->Buf, TxnPtr->Len);
+	TxnPtr->Active = 1U;
+
+	TxnPtr->Len = 0U;
+	TxnPtr->LastWrite = TxnPtr->Size;
+	if (Ret != XAIELIB_SUCCESS) {
+		TxnPtr->Status = XAIELIB_FAILURE;
+	}
+
+	return Ret;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to record 32bit writes. A write to the
+* address following the previous write extends that command, so registers
+* written in address order end up in one block write.
+*
+* @param	Addr: Address to write to.
+* @param	Data: Pointer to the data to be written.
+* @param	Cnt: Number of 32bit words to write.
+*
+* @return	None.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static void XAieLib_TxnWrite(u64 Addr, const u32 *Data, u32 Cnt)
+{
+	XAieLib_Txn *TxnPtr = &XAieLib_TxnInst;
+	u32 Idx, CmdLen;
+
+	for (Idx = 0U; Idx < Cnt; Idx++, Addr += 4U) {
+		if ((TxnPtr->LastWrite < TxnPtr->Size) &&
+				(TxnPtr->NextAddr == Addr) &&
+				(TxnPtr->Len < TxnPtr->Size)) {
+			CmdLen = (TxnPtr->Buf[TxnPtr->LastWrite] >>
+				  XAIELIB_TXN_LEN_LSB) & XAIELIB_TXN_LEN_MASK;
+			/* Stay with a one word header */
+			if ((CmdLen + 1U) < XAIELIB_TXN_LONG_LEN) {
+				TxnPtr->Buf[TxnPtr->LastWrite] =
+					XAIELIB_TXN_HDR(XAIELIB_TXN_DMA_WRITE,
+							CmdLen + 1U);
+				TxnPtr->Buf[TxnPtr->Len++] = Data[Idx];
+				TxnPtr->NextAddr += 4U;
+				continue;
+			}
+		}
+
+		if ((TxnPtr->Size - TxnPtr->Len) < (XAIELIB_TXN_WRITE_LEN + 1U)) {
+			(void)XAieLib_TxnSync();
+		}
+		TxnPtr->LastWrite = TxnPtr->Len;
+		TxnPtr->Buf[TxnPtr->Len++] =
+			XAIELIB_TXN_HDR(XAIELIB_TXN_WRITE64, XAIELIB_TXN_WRITE_LEN);
+		TxnPtr->Buf[TxnPtr->Len++] = (u32)(Addr >> 32U);
+		TxnPtr->Buf[TxnPtr->Len++] = (u32)Addr;
+		TxnPtr->Buf[TxnPtr->Len++] = Data[Idx];
+		TxnPtr->NextAddr = Addr + 4U;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to record a mask write or a mask poll.
+*
+* @param	Cmd: XAIELIB_TXN_MASK_WRITE64 or XAIELIB_TXN_MASK_POLL64.
+* @param	Addr: Address of the register.
+* @param	Mask: Mask to be applied.
+* @param	Value: Data to write, or the expected value.
+* @param	TimeOutUs: Poll timeout in usec. Not used for writes.
+*
+* @return	None.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static void XAieLib_TxnMaskCmd(u32 Cmd, u64 Addr, u32 Mask, u32 Value,
+		u32 TimeOutUs)
+{
+	XAieLib_Txn *TxnPtr = &XAieLib_TxnInst;
+	u32 CmdLen = (Cmd == XAIELIB_TXN_MASK_POLL64) ?
+		XAIELIB_TXN_MASK_POLL_LEN : XAIELIB_TXN_MASK_WRITE_LEN;
+
+	if ((TxnPtr->Size - TxnPtr->Len) < (CmdLen + 1U)) {
+		(void)XAieLib_TxnSync();
+	}
+	TxnPtr->Buf[TxnPtr->Len++] = XAIELIB_TXN_HDR(Cmd, CmdLen);
+	TxnPtr->Buf[TxnPtr->Len++] = (u32)(Addr >> 32U);
+	TxnPtr->Buf[TxnPtr->Len++] = (u32)Addr;
+	TxnPtr->Buf[TxnPtr->Len++] = Mask;
+	TxnPtr->Buf[TxnPtr->Len++] = Value;
+	if (Cmd == XAIELIB_TXN_MASK_POLL64) {
+		TxnPtr->Buf[TxnPtr->Len++] = TimeOutUs;
+	}
+	/* A mask write may land in the middle of a block */
+	TxnPtr->LastWrite = TxnPtr->Size;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API starts a transaction. Until XAieLib_TxnEnd(), writes, mask writes
+* and mask polls are recorded into the buffer instead of being issued, and
+* writes to consecutive addresses are merged into block writes.
+*
+* @param	Buf: Buffer for the commands.
+* @param	Size: Size of the buffer in 32bit words.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE if a
+*		transaction is already active or the buffer is too small.
+*
+* @note		The buffer holds PLM generic CDO commands (WRITE64,
+*		DMA_WRITE, MASK_WRITE64 and MASK_POLL64), so it can be
+*		executed by the PLM as well as by XAieLib_TxnApply().
+*		Reads, delays, NPI accesses and a full buffer execute the
+*		commands recorded so far before going on, so buffers meant
+*		for the PLM must be large enough for the whole sequence.
+*		A recorded mask poll returns XAIELIB_SUCCESS right away, its
+*		result is reported by XAieLib_TxnFlush() or XAieLib_TxnEnd().
+*
+*******************************************************************************/
+u32 XAieLib_TxnStart(u32 *Buf, u32 Size)
+{
+	XAieLib_Txn *TxnPtr = &XAieLib_TxnInst;
+
+	if ((TxnPtr->Active != 0U) || (Buf == XAIE_NULL) ||
+			(Size < XAIELIB_TXN_MIN_SIZE)) {
+		return XAIELIB_FAILURE;
+	}
+
+	TxnPtr->Buf = Buf;
+	TxnPtr->Size = Size;
+	TxnPtr->Len = 0U;
+	TxnPtr->LastWrite = Size;
+	TxnPtr->NextAddr = 0U;
+	TxnPtr->Status = XAIELIB_SUCCESS;
+	TxnPtr->Active = 1U;
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API executes the commands recorded so far in the active transaction.
+* Recording continues at the start of the buffer.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE if no
+*		transaction is active or a command has failed since the
+*		transaction started.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_TxnFlush(void)
+{
+	XAieLib_Txn *TxnPtr = &XAieLib_TxnInst;
+
+	if (TxnPtr->Active == 0U) {
+		return XAIELIB_FAILURE;
+	}
+
+	(void)XAieLib_TxnSync();
+
+	return TxnPtr->Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API ends the active transaction.
+*
+* @param	LenPtr: If not NULL, the recorded commands are left in the
+*		buffer and their number of words is returned here, to be
+*		executed later or handed to the PLM. If NULL, they are
+*		executed.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE if no
+*		transaction is active or a command has failed since the
+*		transaction started.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_TxnEnd(u32 *LenPtr)
+{
+	XAieLib_Txn *TxnPtr = &XAieLib_TxnInst;
+
+	if (TxnPtr->Active == 0U) {
+		return XAIELIB_FAILURE;
+	}
+
+	if (LenPtr == XAIE_NULL) {
+		(void)XAieLib_TxnSync();
+	} else {
+		*LenPtr = TxnPtr->Len;
+	}
+	TxnPtr->Active = 0U;
+
+	return TxnPtr->Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API tells whether a transaction is recording IO operations.
+*
+* @return	1 if a transaction is active, otherwise 0.
+*
+* @note		None.
+*
+*******************************************************************************/
+u8 XAieLib_TxnIsActive(void)
+{
+	return XAieLib_TxnInst.Active;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API executes the commands of a buffer recorded by a transaction.
+*
+* @param	Buf: Pointer to the commands.
+* @param	Len: Number of words, as returned by XAieLib_TxnEnd().
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE if a
+*		command is malformed or a poll times out.
+*
+* @note		If a transaction is active, its recorded commands are
+*		executed first and the buffer is not recorded.
+*
+*******************************************************************************/
+u32 XAieLib_TxnApply(const u32 *Buf, u32 Len)
+{
+	XAieLib_Txn *TxnPtr = &XAieLib_TxnInst;
+	u8 Active = TxnPtr->Active;
+	u32 Ret;
+
+	if (Buf == XAIE_NULL) {
+		return XAIELIB_FAILURE;
+	}
+
+	(void)XAieLib_TxnSync();
+	TxnPtr->Active = 0U;
+	Ret = XAieLib_TxnRun(Buf, Len);
+	TxnPtr->Active = Active;
+
+	return Ret;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -893,6 +1362,8 @@ u32 XAieLib_MemRead32(XAieLib_MemInst *XAieLib_MemInstPtr, u64 Addr)
 *******************************************************************************/
 u32 XAieLib_Read32(u64 Addr)
 {
+	(void)XAieLib_TxnSync();
+
 #ifdef __AIESIM__
 	return(XAieSim_Read32(Addr));
 #elif defined __AIEBAREMTL__
@@ -919,6 +1390,8 @@ void XAieLib_Read128(u64 Addr, u32 *Data)
 {
 	u8 Idx;
 
+	(void)XAieLib_TxnSync();
+
 	for(Idx = 0U; Idx < 4U; Idx++) {
 #ifdef __AIESIM__
 		Data[Idx] = XAieSim_Read32(Addr + Idx*4U);
@@ -945,6 +1418,11 @@ void XAieLib_Read128(u64 Addr, u32 *Data)
 *******************************************************************************/
 void XAieLib_Write32(u64 Addr, u32 Data)
 {
+	if (XAieLib_TxnInst.Active != 0U) {
+		XAieLib_TxnWrite(Addr, &Data, 1U);
+		return;
+	}
+
 #ifdef __AIESIM__
 	XAieSim_Write32(Addr, Data);
 #elif defined __AIEBAREMTL__
@@ -973,6 +1451,12 @@ void XAieLib_MaskWrite32(u64 Addr, u32 Mask, u32 Data)
 {
 	u32 RegVal;
 
+	if (XAieLib_TxnInst.Active != 0U) {
+		XAieLib_TxnMaskCmd(XAIELIB_TXN_MASK_WRITE64, Addr, Mask, Data,
+				   0U);
+		return;
+	}
+
 #ifdef __AIESIM__
 	XAieSim_MaskWrite32(Addr, Mask, Data);
 #elif defined __AIEBAREMTL__
@@ -1003,6 +1487,11 @@ void XAieLib_MaskWrite32(u64 Addr, u32 Mask, u32 Data)
 *******************************************************************************/
 void XAieLib_Write128(u64 Addr, u32 *Data)
 {
+	if (XAieLib_TxnInst.Active != 0U) {
+		XAieLib_TxnWrite(Addr, Data, 4U);
+		return;
+	}
+
 #ifdef __AIESIM__
 	XAieSim_Write128(Addr, Data);
 #elif defined __AIEBAREMTL__
@@ -1016,6 +1505,46 @@ void XAieLib_Write128(u64 Addr, u32 *Data)
 #endif
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to zero consecutive 32bit words starting at
+* the specified address.
+*
+* @param	Addr: Address to write to.
+* @param	Len: Number of 32bit words to zero.
+*
+* @return	None.
+*
+* @note		In a transaction the zeros are recorded as writes, which are
+*		merged into block writes.
+*
+*******************************************************************************/
+void XAieLib_ZeroBlock32(u64 Addr, u32 Len)
+{
+	const u32 Zero = 0U;
+	u32 Idx;
+
+	if (XAieLib_TxnInst.Active != 0U) {
+		for (Idx = 0U; Idx < Len; Idx++) {
+			XAieLib_TxnWrite(Addr + Idx * 4U, &Zero, 1U);
+		}
+		return;
+	}
+
+#ifdef __AIESIM__
+	for (Idx = 0U; Idx < Len; Idx++) {
+		XAieSim_Write32(Addr + Idx * 4U, 0U);
+	}
+#elif defined __AIEBAREMTL__
+	for (Idx = 0U; Idx < Len; Idx++) {
+		Xil_Out32(Addr + Idx * 4U, 0U);
+	}
+#else
+	XAieIO_ZeroBlock32(Addr, Len);
+#endif
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1032,6 +1561,8 @@ void XAieLib_Write128(u64 Addr, u32 *Data)
 void XAieLib_WriteCmd(u8 Command, u8 ColId, u8 RowId, u32 CmdWd0,
 						u32 CmdWd1, u8 *CmdStr)
 {
+	(void)XAieLib_TxnSync();
+
 #ifdef __AIESIM__
 	XAieSim_WriteCmd(Command, ColId, RowId, CmdWd0, CmdWd1, CmdStr);
 #elif defined __AIEBAREMTL__
@@ -1058,6 +1589,12 @@ u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs)
 {
 	u32 Ret = XAIELIB_FAILURE;
 
+	if (XAieLib_TxnInst.Active != 0U) {
+		XAieLib_TxnMaskCmd(XAIELIB_TXN_MASK_POLL64, Addr, Mask, Value,
+				   TimeOutUs);
+		return XAIELIB_SUCCESS;
+	}
+
 #ifdef __AIESIM__
 	if (XAieSim_MaskPoll(Addr, Mask, Value, TimeOutUs) == XAIESIM_SUCCESS) {
 		Ret = XAIELIB_SUCCESS;
@@ -1104,6 +1641,8 @@ u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs)
 *******************************************************************************/
 u32 XAieLib_NPIRead32(u64 Addr)
 {
+	(void)XAieLib_TxnSync();
+
 #ifdef __AIESIM__
 	return XAieSim_NPIRead32(Addr);
 #elif defined __AIEBAREMTL__
@@ -1160,6 +1699,7 @@ static void XAieLib_NPISetLock(u8 Lock)
 *******************************************************************************/
 void XAieLib_NPIWrite32(u64 Addr, u32 Data)
 {
+	(void)XAieLib_TxnSync();
 	XAieLib_NPISetLock(0);
 #ifdef __AIESIM__
 	XAieSim_NPIWrite32(Addr, Data);
@@ -1190,6 +1730,7 @@ void XAieLib_NPIMaskWrite32(u64 Addr, u32 Mask, u32 Data)
 {
 	u32 RegVal;
 
+	(void)XAieLib_TxnSync();
 	XAieLib_NPISetLock(0);
 #ifdef __AIESIM__
 	XAieSim_NPIMaskWrite32(Addr, Mask, Data);
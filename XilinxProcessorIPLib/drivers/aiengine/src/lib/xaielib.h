@@ -26,6 +26,9 @@
 * 1.7  Hyun    01/08/2019  Add XAieLib_MaskPoll()
 * 1.8  Tejus   10/14/2019  Enable assertion for linux and simulation
 * 1.9  Wendy   02/25/2020  Add Logging API
+* 2.0  agt     10/18/2026  Add the transaction API
+* 2.1  agt     10/18/2026  Add XAieLib_ZeroBlock32()
+* 2.2  agt     10/18/2026  Add XAieLib_WriteBlock32() and XAieLib_ReadBlock32()
 * </pre>
 *
 ******************************************************************************/
@@ -67,9 +70,18 @@ void XAieLib_Read128(u64 Addr, u32 *Data);
 void XAieLib_Write32(u64 Addr, u32 Data);
 void XAieLib_MaskWrite32(u64 Addr, u32 Mask, u32 Data);
 void XAieLib_Write128(u64 Addr, u32 *Data);
+void XAieLib_WriteBlock32(u64 Addr, const u32 *Data, u32 Len);
+void XAieLib_ReadBlock32(u64 Addr, u32 *Data, u32 Len);
+void XAieLib_ZeroBlock32(u64 Addr, u32 Len);
 void XAieLib_WriteCmd(u8 Command, u8 ColId, u8 RowId, u32 CmdWd0, u32 CmdWd1, u8 *CmdStr);
 u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs);
 
+u32 XAieLib_TxnStart(u32 *Buf, u32 Size);
+u32 XAieLib_TxnFlush(void);
+u32 XAieLib_TxnEnd(u32 *LenPtr);
+u8 XAieLib_TxnIsActive(void);
+u32 XAieLib_TxnApply(const u32 *Buf, u32 Len);
+
 u32 XAieLib_NPIRead32(u64 Addr);
 void XAieLib_NPIWrite32(u64 Addr, u32 Data);
 u32 XAieLib_NPIMaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs);
@@ -0,0 +1,457 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaietile_elf.c
+* @{
+*
+* This file contains routines to parse an AIE ELF once into a list of memory
+* segments and load it to any number of tiles. Contiguous sections are
+* coalesced, and each segment is written with one block write or zeroed with
+* one block operation, instead of word by word.
+*
+* The sections are selected as in the simulation ELF loader: allocated
+* PROGBITS sections are loaded, and NOBITS sections are zeroed only when
+* located in data memory, as the AIE compiler emits some bss sections with
+* invalid addresses. The ELF buffer is not modified.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/18/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#include "xaiegbl_defs.h"
+#include "xaiegbl.h"
+#include "xaiegbl_reginit.h"
+#include "xaietile_core.h"
+#include "xaietile_elf.h"
+
+/***************************** Include Files *********************************/
+
+/***************************** Macro Definitions *****************************/
+#define XAIETILE_ELF_EI_CLASS		4U
+#define XAIETILE_ELF_EI_DATA		5U
+#define XAIETILE_ELF_CLASS32		1U
+#define XAIETILE_ELF_DATA2LSB		1U
+
+#define XAIETILE_ELF_E_SHOFF		0x20U
+#define XAIETILE_ELF_E_SHENTSIZE	0x2EU
+#define XAIETILE_ELF_E_SHNUM		0x30U
+
+#define XAIETILE_ELF_SH_TYPE		0x04U
+#define XAIETILE_ELF_SH_FLAGS		0x08U
+#define XAIETILE_ELF_SH_ADDR		0x0CU
+#define XAIETILE_ELF_SH_OFFSET		0x10U
+#define XAIETILE_ELF_SH_SIZE		0x14U
+
+#define XAIETILE_ELF_SHT_PROGBITS	1U
+#define XAIETILE_ELF_SHT_NOBITS		8U
+#define XAIETILE_ELF_SHF_WRITE		0x1U
+#define XAIETILE_ELF_SHF_ALLOC		0x2U
+#define XAIETILE_ELF_SHF_EXECINSTR	0x4U
+
+/* Data memory is seen by the core from 0x20000, one 32KB bank per direction */
+#define XAIETILE_ELF_DM_ADDR_MIN	0x20000U
+#define XAIETILE_ELF_DM_BANK_MASK	0x7FFFU
+#define XAIETILE_ELF_DM_DIR_MASK	0x18000U
+#define XAIETILE_ELF_DM_DIR_SHIFT	15U
+
+/************************** Variable Definitions *****************************/
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This is the internal function to read a little endian 16-bit ELF field.
+*
+* @param	Ptr - Pointer to the field.
+*
+* @return	Field value.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static u16 XAieTile_ElfGet16(const u8 *Ptr)
+{
+	return (u16)(Ptr[0U] | ((u16)Ptr[1U] << 8U));
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to read a little endian 32-bit ELF field.
+*
+* @param	Ptr - Pointer to the field.
+*
+* @return	Field value.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static u32 XAieTile_ElfGet32(const u8 *Ptr)
+{
+	return (u32)Ptr[0U] | ((u32)Ptr[1U] << 8U) | ((u32)Ptr[2U] << 16U) |
+		((u32)Ptr[3U] << 24U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to add a section to the image. Data and bss
+* sections are split at the data memory bank boundaries, and each piece is
+* merged into the last segment when it follows it both in the core address
+* space and in the ELF buffer.
+*
+* @param	ImgPtr - Pointer to the image.
+* @param	Type - Segment type, XAIETILE_ELF_SEG_*.
+* @param	Addr - AIE core address of the section.
+* @param	Size - Size of the section in bytes.
+* @param	Data - Section content in the ELF buffer, NULL for bss.
+*
+* @return	XAIE_SUCCESS on success, otherwise XAIE_FAILURE if the image
+*		has no free segment.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static u8 XAieTile_ElfAddSection(XAieTile_ElfImage *ImgPtr, u8 Type,
+		u32 Addr, u32 Size, const u32 *Data)
+{
+	XAieTile_ElfSeg *SegPtr;
+	u32 Chunk;
+	u32 NumWords;
+
+	while (Size > 0U) {
+		Chunk = Size;
+		if (Type != XAIETILE_ELF_SEG_PROG) {
+			if (Chunk > (XAIEGBL_TILE_DATAMEM_SIZE -
+					(Addr & XAIETILE_ELF_DM_BANK_MASK))) {
+				Chunk = XAIEGBL_TILE_DATAMEM_SIZE -
+					(Addr & XAIETILE_ELF_DM_BANK_MASK);
+			}
+		}
+		NumWords = (Chunk + 3U) / 4U;
+
+		SegPtr = (ImgPtr->NumSegs > 0U) ?
+			&ImgPtr->Segs[ImgPtr->NumSegs - 1U] : XAIE_NULL;
+		if ((SegPtr != XAIE_NULL) && (SegPtr->Type == Type) &&
+				((SegPtr->Addr + (SegPtr->NumWords * 4U)) ==
+				 Addr) &&
+				((Type == XAIETILE_ELF_SEG_PROG) ||
+				 ((SegPtr->Addr & ~XAIETILE_ELF_DM_BANK_MASK) ==
+				  (Addr & ~XAIETILE_ELF_DM_BANK_MASK))) &&
+				((Data == XAIE_NULL) ||
+				 ((SegPtr->Data + SegPtr->NumWords) == Data))) {
+			SegPtr->NumWords += NumWords;
+		} else {
+			if (ImgPtr->NumSegs >= ImgPtr->MaxSegs) {
+				XAie_print("ELF has more than %d segments\n",
+						ImgPtr->MaxSegs);
+				return XAIE_FAILURE;
+			}
+			SegPtr = &ImgPtr->Segs[ImgPtr->NumSegs++];
+			SegPtr->Type = Type;
+			SegPtr->Addr = Addr;
+			SegPtr->NumWords = NumWords;
+			SegPtr->Data = Data;
+		}
+
+		Addr += Chunk;
+		Size -= Chunk;
+		if (Data != XAIE_NULL) {
+			Data += NumWords;
+		}
+	}
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to return the address of data memory seen by
+* a core at a core address.
+*
+* @param	AieInst - Pointer to the AIE instance.
+* @param	TileInstPtr - Pointer to the Tile instance of the core.
+* @param	Addr - AIE core address in data memory.
+* @param	DmAddrPtr - Pointer to return the data memory address.
+*
+* @return	XAIE_SUCCESS on success, otherwise XAIE_FAILURE if the bank
+*		is out of the array.
+*
+* @note		Used only in this file. The west memory is the one of the
+*		tile on the left in odd rows, and the east memory is the one
+*		of the tile on the right in even rows.
+*
+*******************************************************************************/
+static u8 XAieTile_ElfDmAddr(XAieGbl *AieInst, XAieGbl_Tile *TileInstPtr,
+		u32 Addr, u64 *DmAddrPtr)
+{
+	u16 Row = TileInstPtr->RowId;
+	u16 Col = TileInstPtr->ColId;
+
+	switch ((Addr & XAIETILE_ELF_DM_DIR_MASK) >>
+			XAIETILE_ELF_DM_DIR_SHIFT) {
+	case 0U:
+		/* South */
+		Row--;
+		break;
+	case 1U:
+		/* West */
+		if ((Row % 2U) == 1U) {
+			if (Col == 0U) {
+				return XAIE_FAILURE;
+			}
+			Col--;
+		}
+		break;
+	case 2U:
+		/* North */
+		Row++;
+		break;
+	default:
+		/* East */
+		if ((Row % 2U) == 0U) {
+			Col++;
+		}
+		break;
+	}
+
+	if ((Row == 0U) || (Row > AieInst->Config->NumRows) ||
+			(Col >= AieInst->Config->NumCols)) {
+		return XAIE_FAILURE;
+	}
+
+	*DmAddrPtr = AieInst->Tiles[((u32)Col *
+			((u32)AieInst->Config->NumRows + 1U)) + Row].TileAddr +
+		XAIEGBL_TILE_DATAMEM_BASE + (Addr & XAIETILE_ELF_DM_BANK_MASK);
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API parses an AIE ELF into an image of memory segments. The image can
+* be kept and loaded to any number of tiles, without parsing the ELF again.
+*
+* @param	ImgPtr - Pointer to the image.
+* @param	ElfPtr - Pointer to the ELF in memory. Should be 32-bit
+*		aligned, and stay valid while the image is used.
+* @param	Segs - Array of segments for the image.
+* @param	MaxSegs - Number of entries of Segs.
+*
+* @return	XAIE_SUCCESS on success, otherwise XAIE_FAILURE if the ELF is
+*		not a 32-bit little endian ELF, a section is not word
+*		aligned or the segments don't fit.
+*
+* @note		None.
+*
+*******************************************************************************/
+u8 XAieTile_ElfParse(XAieTile_ElfImage *ImgPtr, const u8 *ElfPtr,
+		XAieTile_ElfSeg *Segs, u32 MaxSegs)
+{
+	const u8 *ShPtr;
+	const u32 *Data;
+	u32 ShOff;
+	u32 Type, Flags, Addr, Offset, Size;
+	u16 ShEntSize;
+	u16 ShNum;
+	u16 Idx;
+	u8 SegType;
+
+	XAie_AssertNonvoid(ImgPtr != XAIE_NULL);
+	XAie_AssertNonvoid(ElfPtr != XAIE_NULL);
+	XAie_AssertNonvoid(Segs != XAIE_NULL);
+
+	ImgPtr->Segs = Segs;
+	ImgPtr->NumSegs = 0U;
+	ImgPtr->MaxSegs = MaxSegs;
+
+	if ((ElfPtr[0U] != 0x7FU) || (ElfPtr[1U] != 'E') ||
+			(ElfPtr[2U] != 'L') || (ElfPtr[3U] != 'F') ||
+			(ElfPtr[XAIETILE_ELF_EI_CLASS] !=
+			 XAIETILE_ELF_CLASS32) ||
+			(ElfPtr[XAIETILE_ELF_EI_DATA] !=
+			 XAIETILE_ELF_DATA2LSB) ||
+			(((uintptr_t)ElfPtr & 0x3U) != 0U)) {
+		XAie_print("Invalid AIE ELF\n");
+		return XAIE_FAILURE;
+	}
+
+	ShOff = XAieTile_ElfGet32(ElfPtr + XAIETILE_ELF_E_SHOFF);
+	ShEntSize = XAieTile_ElfGet16(ElfPtr + XAIETILE_ELF_E_SHENTSIZE);
+	ShNum = XAieTile_ElfGet16(ElfPtr + XAIETILE_ELF_E_SHNUM);
+
+	for (Idx = 0U; Idx < ShNum; Idx++) {
+		ShPtr = ElfPtr + ShOff + ((u32)Idx * ShEntSize);
+		Type = XAieTile_ElfGet32(ShPtr + XAIETILE_ELF_SH_TYPE);
+		Flags = XAieTile_ElfGet32(ShPtr + XAIETILE_ELF_SH_FLAGS);
+		Addr = XAieTile_ElfGet32(ShPtr + XAIETILE_ELF_SH_ADDR);
+		Offset = XAieTile_ElfGet32(ShPtr + XAIETILE_ELF_SH_OFFSET);
+		Size = XAieTile_ElfGet32(ShPtr + XAIETILE_ELF_SH_SIZE);
+
+		Data = XAIE_NULL;
+		if (Type == XAIETILE_ELF_SHT_PROGBITS) {
+			if (Flags == (XAIETILE_ELF_SHF_ALLOC |
+					XAIETILE_ELF_SHF_EXECINSTR)) {
+				SegType = XAIETILE_ELF_SEG_PROG;
+			} else if ((Flags == XAIETILE_ELF_SHF_ALLOC) ||
+					(Flags == (XAIETILE_ELF_SHF_ALLOC |
+					 XAIETILE_ELF_SHF_WRITE))) {
+				SegType = XAIETILE_ELF_SEG_DATA;
+			} else {
+				continue;
+			}
+			Data = (const u32 *)(ElfPtr + Offset);
+		} else if ((Type == XAIETILE_ELF_SHT_NOBITS) &&
+				(Addr >= XAIETILE_ELF_DM_ADDR_MIN)) {
+			SegType = XAIETILE_ELF_SEG_BSS;
+		} else {
+			continue;
+		}
+
+		if (Size == 0U) {
+			continue;
+		}
+
+		if (((Addr & 0x3U) != 0U) || ((Offset & 0x3U) != 0U)) {
+			XAie_print("ELF section %d is not word aligned\n", Idx);
+			return XAIE_FAILURE;
+		}
+
+		if (XAieTile_ElfAddSection(ImgPtr, SegType, Addr, Size,
+					Data) != XAIE_SUCCESS) {
+			return XAIE_FAILURE;
+		}
+	}
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API loads a parsed ELF image to a tile. The program memory of the tile
+* and the data memories the core sees are written segment by segment, each
+* with one block write.
+*
+* @param	AieInst - Pointer to the AIE instance.
+* @param	TileInstPtr - Pointer to the Tile instance.
+* @param	ImgPtr - Pointer to the image from XAieTile_ElfParse().
+*
+* @return	XAIE_SUCCESS on success, otherwise XAIE_FAILURE if a segment
+*		is out of the program memory or the array.
+*
+* @note		The core should be disabled. On the simulation backend, the
+*		load time of the tile is logged in core timer cycles.
+*
+*******************************************************************************/
+u8 XAieTile_ElfLoad(XAieGbl *AieInst, XAieGbl_Tile *TileInstPtr,
+		const XAieTile_ElfImage *ImgPtr)
+{
+	const XAieTile_ElfSeg *SegPtr;
+	u64 DmAddr;
+	u32 Idx;
+#ifdef __AIESIM__
+	u64 StartTime;
+#endif
+
+	XAie_AssertNonvoid(AieInst != XAIE_NULL);
+	XAie_AssertNonvoid(TileInstPtr != XAIE_NULL);
+	XAie_AssertNonvoid(TileInstPtr->TileType == XAIEGBL_TILE_TYPE_AIETILE);
+	XAie_AssertNonvoid(ImgPtr != XAIE_NULL);
+
+#ifdef __AIESIM__
+	StartTime = XAieTile_CoreReadTimer(TileInstPtr);
+#endif
+
+	for (Idx = 0U; Idx < ImgPtr->NumSegs; Idx++) {
+		SegPtr = &ImgPtr->Segs[Idx];
+
+		if (SegPtr->Type == XAIETILE_ELF_SEG_PROG) {
+			if ((SegPtr->Addr + (SegPtr->NumWords * 4U)) >
+					XAIEGBL_TILE_PROGMEM_SIZE) {
+				XAie_print("ELF program exceeds program "
+						"memory\n");
+				return XAIE_FAILURE;
+			}
+			XAieGbl_WriteBlock32(TileInstPtr->TileAddr +
+					XAIEGBL_TILE_PROGMEM_BASE +
+					SegPtr->Addr, SegPtr->Data,
+					SegPtr->NumWords);
+			continue;
+		}
+
+		if (XAieTile_ElfDmAddr(AieInst, TileInstPtr, SegPtr->Addr,
+					&DmAddr) != XAIE_SUCCESS) {
+			XAie_print("ELF data at 0x%x is out of the array for "
+					"tile(%d,%d)\n", SegPtr->Addr,
+					TileInstPtr->ColId,
+					TileInstPtr->RowId);
+			return XAIE_FAILURE;
+		}
+
+		if (SegPtr->Type == XAIETILE_ELF_SEG_DATA) {
+			XAieGbl_WriteBlock32(DmAddr, SegPtr->Data,
+					SegPtr->NumWords);
+		} else {
+			XAieGbl_ZeroBlock32(DmAddr, SegPtr->NumWords);
+		}
+	}
+
+#ifdef __AIESIM__
+	XAieLib_log(XAIELIB_LOGINFO,
+			"Tile(%d,%d) ELF loaded in %lu cycles\n",
+			TileInstPtr->ColId, TileInstPtr->RowId,
+			(unsigned long)(XAieTile_CoreReadTimer(TileInstPtr) -
+					StartTime));
+#endif
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API loads the same parsed ELF image to several tiles.
+*
+* @param	AieInst - Pointer to the AIE instance.
+* @param	TileInstPtrs - Array of pointers to the Tile instances.
+* @param	NumTiles - Number of tiles in the array.
+* @param	ImgPtr - Pointer to the image from XAieTile_ElfParse().
+*
+* @return	XAIE_SUCCESS on success, otherwise XAIE_FAILURE if the image
+*		doesn't fit a tile. The tiles before it are loaded.
+*
+* @note		The ELF is parsed once for all the tiles. Within a
+*		transaction, all the tiles are loaded with one submission.
+*
+*******************************************************************************/
+u8 XAieTile_ElfLoadMulti(XAieGbl *AieInst, XAieGbl_Tile **TileInstPtrs,
+		u32 NumTiles, const XAieTile_ElfImage *ImgPtr)
+{
+	u32 Idx;
+
+	XAie_AssertNonvoid(TileInstPtrs != XAIE_NULL);
+
+	for (Idx = 0U; Idx < NumTiles; Idx++) {
+		if (XAieTile_ElfLoad(AieInst, TileInstPtrs[Idx], ImgPtr) !=
+				XAIE_SUCCESS) {
+			return XAIE_FAILURE;
+		}
+	}
+
+	return XAIE_SUCCESS;
+}
+
+/** @} */
@@ -0,0 +1,66 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaietile_elf.h
+* @{
+*
+*  Header file for the parsed ELF image loader.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/18/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIETILE_ELF_H
+#define XAIETILE_ELF_H
+
+/***************************** Include Files *********************************/
+
+/***************************** Constant Definitions **************************/
+#define XAIETILE_ELF_SEG_PROG		0U	/* Program memory */
+#define XAIETILE_ELF_SEG_DATA		1U	/* Data memory */
+#define XAIETILE_ELF_SEG_BSS		2U	/* Data memory to zero */
+
+/***************************** Type Definitions ******************************/
+/**
+ * This typedef contains a segment of a parsed ELF image. A data segment
+ * never crosses a 32KB data memory bank, so it is written to one tile.
+ */
+typedef struct {
+	u32 Addr;		/**< AIE core address */
+	u32 NumWords;		/**< Number of 32-bit words */
+	const u32 *Data;	/**< Words in the ELF buffer, NULL for bss */
+	u8 Type;		/**< XAIETILE_ELF_SEG_* */
+} XAieTile_ElfSeg;
+
+/**
+ * This typedef contains a parsed ELF image. The segments point into the ELF
+ * buffer, which should stay valid while the image is used.
+ */
+typedef struct {
+	XAieTile_ElfSeg *Segs;	/**< Segments */
+	u32 NumSegs;		/**< Number of segments */
+	u32 MaxSegs;		/**< Number of entries of Segs */
+} XAieTile_ElfImage;
+
+/***************************** Macro Definitions *****************************/
+
+/************************** Function Prototypes  *****************************/
+u8 XAieTile_ElfParse(XAieTile_ElfImage *ImgPtr, const u8 *ElfPtr,
+		XAieTile_ElfSeg *Segs, u32 MaxSegs);
+u8 XAieTile_ElfLoad(XAieGbl *AieInst, XAieGbl_Tile *TileInstPtr,
+		const XAieTile_ElfImage *ImgPtr);
+u8 XAieTile_ElfLoadMulti(XAieGbl *AieInst, XAieGbl_Tile **TileInstPtrs,
+		u32 NumTiles, const XAieTile_ElfImage *ImgPtr);
+
+#endif		/* end of protection macro */
+/** @} */
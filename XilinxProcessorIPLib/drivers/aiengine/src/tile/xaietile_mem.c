@@ -20,6 +20,7 @@
 * 1.1  Naresh  07/11/2018  Updated copyright info and addressed CR#1006589
 * 1.2  Nishad  12/05/2018  Renamed ME attributes to AIE
 * 1.3  Hyun    06/27/2019  Add XAieTile_MemReadTimer()
+* 1.4  agt     10/18/2026  Add the data memory block functions
 * </pre>
 *
 ******************************************************************************/
@@ -89,6 +90,147 @@ u32 XAieTile_DmReadWord(XAieGbl_Tile *TileInstPtr, u32 DmOffset)
 	return(XAieGbl_Read32(DmAddr));
 }
 
+/*****************************************************************************/
+/**
+*
+* This API writes a block of 32-bit words to the data memory of the selected
+* tile, starting at the specified offset.
+*
+* @param	TileInstPtr - Pointer to the Tile instance.
+* @param	DmOffset - Data memory offset to write to. Should be word
+*		aligned.
+* @param	Data - Pointer to the words to be written.
+* @param	NumWords - Number of words to write.
+*
+* @return	None.
+*
+* @note		The block is written with one block write, or recorded as
+*		one command if a transaction is active.
+*
+*******************************************************************************/
+void XAieTile_DmWriteBlock(XAieGbl_Tile *TileInstPtr, u32 DmOffset,
+		const u32 *Data, u32 NumWords)
+{
+	XAie_AssertVoid(TileInstPtr != XAIE_NULL);
+	XAie_AssertVoid(TileInstPtr->TileType == XAIEGBL_TILE_TYPE_AIETILE);
+	XAie_AssertVoid(Data != XAIE_NULL);
+	XAie_AssertVoid((DmOffset & 0x3U) == 0U);
+	XAie_AssertVoid(DmOffset <= XAIEGBL_TILE_DATAMEM_SIZE);
+	XAie_AssertVoid(NumWords <=
+			((XAIEGBL_TILE_DATAMEM_SIZE - DmOffset) / 4U));
+
+	XAieGbl_WriteBlock32(TileInstPtr->TileAddr +
+			XAIEGBL_TILE_DATAMEM_BASE + DmOffset, Data, NumWords);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reads a block of 32-bit words from the data memory of the selected
+* tile, starting at the specified offset.
+*
+* @param	TileInstPtr - Pointer to the Tile instance.
+* @param	DmOffset - Data memory offset to read from. Should be word
+*		aligned.
+* @param	Data - Pointer to the buffer to store the read words.
+* @param	NumWords - Number of words to read.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieTile_DmReadBlock(XAieGbl_Tile *TileInstPtr, u32 DmOffset, u32 *Data,
+		u32 NumWords)
+{
+	XAie_AssertVoid(TileInstPtr != XAIE_NULL);
+	XAie_AssertVoid(TileInstPtr->TileType == XAIEGBL_TILE_TYPE_AIETILE);
+	XAie_AssertVoid(Data != XAIE_NULL);
+	XAie_AssertVoid((DmOffset & 0x3U) == 0U);
+	XAie_AssertVoid(DmOffset <= XAIEGBL_TILE_DATAMEM_SIZE);
+	XAie_AssertVoid(NumWords <=
+			((XAIEGBL_TILE_DATAMEM_SIZE - DmOffset) / 4U));
+
+	XAieGbl_ReadBlock32(TileInstPtr->TileAddr +
+			XAIEGBL_TILE_DATAMEM_BASE + DmOffset, Data, NumWords);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API fills a range of the data memory of the selected tile with a
+* 32-bit value.
+*
+* @param	TileInstPtr - Pointer to the Tile instance.
+* @param	DmOffset - Data memory offset to start from. Should be word
+*		aligned.
+* @param	DmVal - 32-bit value to be written.
+* @param	NumWords - Number of words to fill.
+*
+* @return	None.
+*
+* @note		Zero fills are done with one block operation, except in a
+*		transaction where they are recorded like any other fill.
+*
+*******************************************************************************/
+void XAieTile_DmFill(XAieGbl_Tile *TileInstPtr, u32 DmOffset, u32 DmVal,
+		u32 NumWords)
+{
+	u64 DmAddr;
+	u32 Idx;
+
+	XAie_AssertVoid(TileInstPtr != XAIE_NULL);
+	XAie_AssertVoid(TileInstPtr->TileType == XAIEGBL_TILE_TYPE_AIETILE);
+	XAie_AssertVoid((DmOffset & 0x3U) == 0U);
+	XAie_AssertVoid(DmOffset <= XAIEGBL_TILE_DATAMEM_SIZE);
+	XAie_AssertVoid(NumWords <=
+			((XAIEGBL_TILE_DATAMEM_SIZE - DmOffset) / 4U));
+
+	DmAddr = TileInstPtr->TileAddr + XAIEGBL_TILE_DATAMEM_BASE + DmOffset;
+
+	/* In a transaction the words are recorded and merged as block writes */
+	if ((DmVal == 0U) && (XAieGbl_TxnIsActive() == 0U)) {
+		XAieGbl_ZeroBlock32(DmAddr, NumWords);
+		return;
+	}
+
+	for (Idx = 0U; Idx < NumWords; Idx++) {
+		XAieGbl_Write32(DmAddr + Idx * 4U, DmVal);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the same block of 32-bit words to the data memory of
+* several tiles, at the same offset in each.
+*
+* @param	TileInstPtrs - Array of pointers to the Tile instances.
+* @param	NumTiles - Number of tiles in the array.
+* @param	DmOffset - Data memory offset to write to. Should be word
+*		aligned.
+* @param	Data - Pointer to the words to be written.
+* @param	NumWords - Number of words to write.
+*
+* @return	None.
+*
+* @note		Used to load the same coefficients or initial data into all
+*		the tiles running a kernel.
+*
+*******************************************************************************/
+void XAieTile_DmWriteBlockMulti(XAieGbl_Tile **TileInstPtrs, u32 NumTiles,
+		u32 DmOffset, const u32 *Data, u32 NumWords)
+{
+	u32 Idx;
+
+	XAie_AssertVoid(TileInstPtrs != XAIE_NULL);
+
+	for (Idx = 0U; Idx < NumTiles; Idx++) {
+		XAieTile_DmWriteBlock(TileInstPtrs[Idx], DmOffset, Data,
+				NumWords);
+	}
+}
+
 /*****************************************************************************/
 /**
 *
@@ -20,6 +20,7 @@
 * 1.1  Naresh  07/11/2018  Updated copyright info and addressed CR#1006589
 * 1.2  Nishad  12/05/2018  Renamed ME attributes to AIE
 * 1.3  Hyun    06/27/2018  Add XAieTile_MemReadTimer()
+* 1.4  agt     10/18/2026  Add the data memory block functions
 * </pre>
 *
 ******************************************************************************/
@@ -37,6 +38,14 @@
 /************************** Function Prototypes  *****************************/
 void XAieTile_DmWriteWord(XAieGbl_Tile *TileInstPtr, u32 DmOffset, u32 DmVal);
 u32 XAieTile_DmReadWord(XAieGbl_Tile *TileInstPtr, u32 DmOffset);
+void XAieTile_DmWriteBlock(XAieGbl_Tile *TileInstPtr, u32 DmOffset,
+		const u32 *Data, u32 NumWords);
+void XAieTile_DmReadBlock(XAieGbl_Tile *TileInstPtr, u32 DmOffset, u32 *Data,
+		u32 NumWords);
+void XAieTile_DmFill(XAieGbl_Tile *TileInstPtr, u32 DmOffset, u32 DmVal,
+		u32 NumWords);
+void XAieTile_DmWriteBlockMulti(XAieGbl_Tile **TileInstPtrs, u32 NumTiles,
+		u32 DmOffset, const u32 *Data, u32 NumWords);
 u64 XAieTile_MemReadTimer(XAieGbl_Tile *TileInstPtr);
 
 #endif		/* end of protection macro */
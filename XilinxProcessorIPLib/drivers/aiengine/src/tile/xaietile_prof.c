@@ -0,0 +1,465 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaietile_prof.c
+* @{
+*
+* This file contains routines to configure the performance counters of a set
+* of tiles and sample them periodically. Each snapshot holds the memory
+* module timer and the counters of every tile of the set, read with one block
+* read per module, and is kept in a ring allocated by the caller.
+*
+* The statistics are computed from the ring only. Snapshots recorded earlier,
+* ex, with XAieTile_ProfGetSnapshot(), can be fed back with
+* XAieTile_ProfRecord() to an instance initialized without AIE instance, and
+* give the same statistics without the device.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/18/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#include "xaiegbl_defs.h"
+#include "xaiegbl.h"
+#include "xaietile_mem.h"
+#include "xaietile_perfcnt.h"
+#include "xaietile_prof.h"
+
+/***************************** Include Files *********************************/
+
+/***************************** Macro Definitions *****************************/
+
+/************************** Variable Definitions *****************************/
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This is the internal function to return the tile instance of a tile of the
+* set.
+*
+* @param	ProfPtr - Pointer to the sampling instance.
+* @param	TileIdx - Index of the tile in the set.
+*
+* @return	Pointer to the tile instance.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static XAieGbl_Tile *XAieTile_ProfGetTile(XAieTile_Prof *ProfPtr, u32 TileIdx)
+{
+	return &ProfPtr->AieInst->Tiles[((u32)ProfPtr->Loc[TileIdx].Col *
+			((u32)ProfPtr->AieInst->Config->NumRows + 1U)) +
+			ProfPtr->Loc[TileIdx].Row];
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to return the ring slot of a snapshot.
+*
+* @param	ProfPtr - Pointer to the sampling instance.
+* @param	SnapIdx - Index of the snapshot, 0 being the oldest held.
+*
+* @return	Pointer to the first sample of the snapshot.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static XAieTile_ProfSample *XAieTile_ProfSlot(XAieTile_Prof *ProfPtr,
+		u32 SnapIdx)
+{
+	u32 Slot;
+
+	Slot = (ProfPtr->Head + ProfPtr->NumSnaps - ProfPtr->Count + SnapIdx) %
+		ProfPtr->NumSnaps;
+
+	return &ProfPtr->Ring[Slot * ProfPtr->NumTiles];
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to take the next ring slot, overwriting the
+* oldest snapshot once the ring is full.
+*
+* @param	ProfPtr - Pointer to the sampling instance.
+*
+* @return	Pointer to the first sample of the slot.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static XAieTile_ProfSample *XAieTile_ProfPush(XAieTile_Prof *ProfPtr)
+{
+	XAieTile_ProfSample *Samples;
+
+	Samples = &ProfPtr->Ring[ProfPtr->Head * ProfPtr->NumTiles];
+	ProfPtr->Head = (ProfPtr->Head + 1U) % ProfPtr->NumSnaps;
+	if (ProfPtr->Count < ProfPtr->NumSnaps) {
+		ProfPtr->Count++;
+	}
+
+	return Samples;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API initializes a sampling instance for a set of AIE tiles.
+*
+* @param	ProfPtr - Pointer to the sampling instance.
+* @param	AieInst - Pointer to the AIE instance, or XAIE_NULL to only
+*		replay recorded snapshots.
+* @param	Loc - Locations of the tiles of the set. Should stay valid
+*		while the instance is used.
+* @param	NumTiles - Number of tiles of the set.
+* @param	Ring - Ring of NumSnaps * NumTiles samples.
+* @param	NumSnaps - Number of snapshots the ring holds.
+*
+* @return	XAIE_SUCCESS on success, otherwise XAIE_FAILURE if a tile is
+*		not an AIE tile.
+*
+* @note		None.
+*
+*******************************************************************************/
+u8 XAieTile_ProfInit(XAieTile_Prof *ProfPtr, XAieGbl *AieInst,
+		const XAie_LocType *Loc, u32 NumTiles,
+		XAieTile_ProfSample *Ring, u32 NumSnaps)
+{
+	u32 Idx;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+	XAie_AssertNonvoid(Ring != XAIE_NULL);
+	XAie_AssertNonvoid(NumTiles != 0U);
+	XAie_AssertNonvoid(NumSnaps != 0U);
+
+	ProfPtr->AieInst = AieInst;
+	ProfPtr->Loc = Loc;
+	ProfPtr->NumTiles = NumTiles;
+	ProfPtr->Ring = Ring;
+	ProfPtr->NumSnaps = NumSnaps;
+	ProfPtr->Head = 0U;
+	ProfPtr->Count = 0U;
+	ProfPtr->CoreMask = 0U;
+	ProfPtr->MemMask = 0U;
+
+	if (AieInst == XAIE_NULL) {
+		return XAIE_SUCCESS;
+	}
+
+	XAie_AssertNonvoid(AieInst->IsReady == XAIE_COMPONENT_IS_READY);
+	XAie_AssertNonvoid(Loc != XAIE_NULL);
+
+	for (Idx = 0U; Idx < NumTiles; Idx++) {
+		if ((Loc[Idx].Col >= AieInst->Config->NumCols) ||
+				(Loc[Idx].Row == 0U) ||
+				(Loc[Idx].Row > AieInst->Config->NumRows)) {
+			return XAIE_FAILURE;
+		}
+	}
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API configures the same performance counters on all the tiles of the
+* set, and clears them.
+*
+* @param	ProfPtr - Pointer to the sampling instance.
+* @param	CfgPtr - Pointer to the counter configuration.
+*
+* @return	XAIE_SUCCESS on success, otherwise XAIE_FAILURE for a replay
+*		instance.
+*
+* @note		The snapshots held are dropped, as their counts no longer
+*		follow. The register writes can be batched with a transaction.
+*
+*******************************************************************************/
+u8 XAieTile_ProfConfigure(XAieTile_Prof *ProfPtr,
+		const XAieTile_ProfConfig *CfgPtr)
+{
+	XAieGbl_Tile *TileInstPtr;
+	u32 Idx;
+	u8 Cntr;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+	XAie_AssertNonvoid(CfgPtr != XAIE_NULL);
+
+	if (ProfPtr->AieInst == XAIE_NULL) {
+		return XAIE_FAILURE;
+	}
+
+	ProfPtr->CoreMask = 0U;
+	for (Cntr = 0U; Cntr < XAIETILE_PROF_CORE_CNTRS; Cntr++) {
+		if (CfgPtr->Core[Cntr].StartEvent !=
+				XAIETILE_PERFCNT_EVENT_INVALID) {
+			ProfPtr->CoreMask |= 1U << Cntr;
+		}
+	}
+
+	ProfPtr->MemMask = 0U;
+	for (Cntr = 0U; Cntr < XAIETILE_PROF_MEM_CNTRS; Cntr++) {
+		if (CfgPtr->Mem[Cntr].StartEvent !=
+				XAIETILE_PERFCNT_EVENT_INVALID) {
+			ProfPtr->MemMask |= 1U << Cntr;
+		}
+	}
+
+	for (Idx = 0U; Idx < ProfPtr->NumTiles; Idx++) {
+		TileInstPtr = XAieTile_ProfGetTile(ProfPtr, Idx);
+
+		for (Cntr = 0U; Cntr < XAIETILE_PROF_CORE_CNTRS; Cntr++) {
+			if ((ProfPtr->CoreMask & (1U << Cntr)) == 0U) {
+				continue;
+			}
+			(void)XAieTileCore_PerfCounterControl(TileInstPtr, Cntr,
+					CfgPtr->Core[Cntr].StartEvent,
+					CfgPtr->Core[Cntr].StopEvent,
+					CfgPtr->Core[Cntr].ResetEvent);
+			(void)XAieTileCore_PerfCounterSet(TileInstPtr, Cntr,
+					0U);
+		}
+
+		for (Cntr = 0U; Cntr < XAIETILE_PROF_MEM_CNTRS; Cntr++) {
+			if ((ProfPtr->MemMask & (1U << Cntr)) == 0U) {
+				continue;
+			}
+			(void)XAieTileMem_PerfCounterControl(TileInstPtr, Cntr,
+					CfgPtr->Mem[Cntr].StartEvent,
+					CfgPtr->Mem[Cntr].StopEvent,
+					CfgPtr->Mem[Cntr].ResetEvent);
+			(void)XAieTileMem_PerfCounterSet(TileInstPtr, Cntr,
+					0U);
+		}
+	}
+
+	XAieTile_ProfClear(ProfPtr);
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API takes a snapshot of the timer and the configured counters of all
+* the tiles of the set into the ring.
+*
+* @param	ProfPtr - Pointer to the sampling instance.
+*
+* @return	XAIE_SUCCESS on success, otherwise XAIE_FAILURE for a replay
+*		instance.
+*
+* @note		The counters of a module are contiguous, and are read with
+*		one block read. Counters not configured read as 0.
+*
+*******************************************************************************/
+u8 XAieTile_ProfSnapshot(XAieTile_Prof *ProfPtr)
+{
+	XAieTile_ProfSample *Samples;
+	XAieGbl_Tile *TileInstPtr;
+	u32 Idx;
+	u8 Cntr;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+
+	if (ProfPtr->AieInst == XAIE_NULL) {
+		return XAIE_FAILURE;
+	}
+
+	Samples = XAieTile_ProfPush(ProfPtr);
+	for (Idx = 0U; Idx < ProfPtr->NumTiles; Idx++) {
+		TileInstPtr = XAieTile_ProfGetTile(ProfPtr, Idx);
+
+		Samples[Idx].Timestamp = XAieTile_MemReadTimer(TileInstPtr);
+
+		if (ProfPtr->CoreMask != 0U) {
+			XAieGbl_ReadBlock32(TileInstPtr->TileAddr +
+					XAIEGBL_CORE_PERCOU0,
+					Samples[Idx].Core,
+					XAIETILE_PROF_CORE_CNTRS);
+		}
+		for (Cntr = 0U; Cntr < XAIETILE_PROF_CORE_CNTRS; Cntr++) {
+			if ((ProfPtr->CoreMask & (1U << Cntr)) == 0U) {
+				Samples[Idx].Core[Cntr] = 0U;
+			}
+		}
+
+		if (ProfPtr->MemMask != 0U) {
+			XAieGbl_ReadBlock32(TileInstPtr->TileAddr +
+					XAIEGBL_MEM_PERCOU0,
+					Samples[Idx].Mem,
+					XAIETILE_PROF_MEM_CNTRS);
+		}
+		for (Cntr = 0U; Cntr < XAIETILE_PROF_MEM_CNTRS; Cntr++) {
+			if ((ProfPtr->MemMask & (1U << Cntr)) == 0U) {
+				Samples[Idx].Mem[Cntr] = 0U;
+			}
+		}
+	}
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds a recorded snapshot to the ring, to replay a capture.
+*
+* @param	ProfPtr - Pointer to the sampling instance.
+* @param	Samples - Samples of the snapshot, one per tile of the set.
+*
+* @return	XAIE_SUCCESS on success.
+*
+* @note		None.
+*
+*******************************************************************************/
+u8 XAieTile_ProfRecord(XAieTile_Prof *ProfPtr,
+		const XAieTile_ProfSample *Samples)
+{
+	XAieTile_ProfSample *Slot;
+	u32 Idx;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+	XAie_AssertNonvoid(Samples != XAIE_NULL);
+
+	Slot = XAieTile_ProfPush(ProfPtr);
+	for (Idx = 0U; Idx < ProfPtr->NumTiles; Idx++) {
+		Slot[Idx] = Samples[Idx];
+	}
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns a snapshot held in the ring, to export or record it.
+*
+* @param	ProfPtr - Pointer to the sampling instance.
+* @param	SnapIdx - Index of the snapshot, 0 being the oldest held.
+*
+* @return	Pointer to the samples of the snapshot, one per tile of the
+*		set, or XAIE_NULL if the snapshot is not held.
+*
+* @note		The samples are overwritten once the ring wraps.
+*
+*******************************************************************************/
+const XAieTile_ProfSample *XAieTile_ProfGetSnapshot(XAieTile_Prof *ProfPtr,
+		u32 SnapIdx)
+{
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+
+	if (SnapIdx >= ProfPtr->Count) {
+		return XAIE_NULL;
+	}
+
+	return XAieTile_ProfSlot(ProfPtr, SnapIdx);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API drops all the snapshots held in the ring.
+*
+* @param	ProfPtr - Pointer to the sampling instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieTile_ProfClear(XAieTile_Prof *ProfPtr)
+{
+	XAie_AssertVoid(ProfPtr != XAIE_NULL);
+
+	ProfPtr->Head = 0U;
+	ProfPtr->Count = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API computes the statistics of a tile over the snapshots held. With a
+* counter started on an active event and another on a stall event, the
+* per-mille values give the utilization and the stall ratio of the kernel
+* running on the tile.
+*
+* @param	ProfPtr - Pointer to the sampling instance.
+* @param	TileIdx - Index of the tile in the set.
+* @param	StatsPtr - Pointer to return the statistics.
+*
+* @return	XAIE_SUCCESS on success, otherwise XAIE_FAILURE if less than
+*		two snapshots are held.
+*
+* @note		The counts are accumulated between consecutive snapshots,
+*		so a counter may wrap once between two of them.
+*
+*******************************************************************************/
+u8 XAieTile_ProfGetStats(XAieTile_Prof *ProfPtr, u32 TileIdx,
+		XAieTile_ProfStats *StatsPtr)
+{
+	const XAieTile_ProfSample *Prev;
+	const XAieTile_ProfSample *Cur;
+	u32 SnapIdx;
+	u8 Cntr;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+	XAie_AssertNonvoid(StatsPtr != XAIE_NULL);
+	XAie_AssertNonvoid(TileIdx < ProfPtr->NumTiles);
+
+	if (ProfPtr->Count < 2U) {
+		return XAIE_FAILURE;
+	}
+
+	StatsPtr->Cycles = 0U;
+	for (Cntr = 0U; Cntr < XAIETILE_PROF_CORE_CNTRS; Cntr++) {
+		StatsPtr->Core[Cntr] = 0U;
+	}
+	for (Cntr = 0U; Cntr < XAIETILE_PROF_MEM_CNTRS; Cntr++) {
+		StatsPtr->Mem[Cntr] = 0U;
+	}
+
+	Prev = &XAieTile_ProfSlot(ProfPtr, 0U)[TileIdx];
+	for (SnapIdx = 1U; SnapIdx < ProfPtr->Count; SnapIdx++) {
+		Cur = &XAieTile_ProfSlot(ProfPtr, SnapIdx)[TileIdx];
+
+		StatsPtr->Cycles += Cur->Timestamp - Prev->Timestamp;
+		for (Cntr = 0U; Cntr < XAIETILE_PROF_CORE_CNTRS; Cntr++) {
+			StatsPtr->Core[Cntr] += (u32)(Cur->Core[Cntr] -
+					Prev->Core[Cntr]);
+		}
+		for (Cntr = 0U; Cntr < XAIETILE_PROF_MEM_CNTRS; Cntr++) {
+			StatsPtr->Mem[Cntr] += (u32)(Cur->Mem[Cntr] -
+					Prev->Mem[Cntr]);
+		}
+
+		Prev = Cur;
+	}
+
+	for (Cntr = 0U; Cntr < XAIETILE_PROF_CORE_CNTRS; Cntr++) {
+		StatsPtr->CorePermille[Cntr] = (StatsPtr->Cycles == 0U) ? 0U :
+			(u32)((StatsPtr->Core[Cntr] * 1000U) /
+					StatsPtr->Cycles);
+	}
+	for (Cntr = 0U; Cntr < XAIETILE_PROF_MEM_CNTRS; Cntr++) {
+		StatsPtr->MemPermille[Cntr] = (StatsPtr->Cycles == 0U) ? 0U :
+			(u32)((StatsPtr->Mem[Cntr] * 1000U) /
+					StatsPtr->Cycles);
+	}
+
+	return XAIE_SUCCESS;
+}
+
+/** @} */
@@ -0,0 +1,105 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaietile_prof.h
+* @{
+*
+*  Header file for the performance counter sampling of a tile set.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/18/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIETILE_PROF_H
+#define XAIETILE_PROF_H
+
+/***************************** Include Files *********************************/
+
+/***************************** Constant Definitions **************************/
+#define XAIETILE_PROF_CORE_CNTRS		4U
+#define XAIETILE_PROF_MEM_CNTRS			2U
+
+/***************************** Type Definitions ******************************/
+/**
+ * This typedef contains the events of a performance counter. A counter with
+ * XAIETILE_PERFCNT_EVENT_INVALID as start event is not used.
+ */
+typedef struct {
+	u16 StartEvent;		/**< Event ID to start */
+	u16 StopEvent;		/**< Event ID to stop */
+	u16 ResetEvent;		/**< Event ID to reset */
+} XAieTile_ProfCntr;
+
+/**
+ * This typedef contains the counters configured on all the tiles of a set.
+ */
+typedef struct {
+	XAieTile_ProfCntr Core[XAIETILE_PROF_CORE_CNTRS]; /**< Core module counters */
+	XAieTile_ProfCntr Mem[XAIETILE_PROF_MEM_CNTRS];	/**< Memory module counters */
+} XAieTile_ProfConfig;
+
+/**
+ * This typedef contains the sample of one tile in a snapshot.
+ */
+typedef struct {
+	u64 Timestamp;				/**< Memory module timer */
+	u32 Core[XAIETILE_PROF_CORE_CNTRS];	/**< Core module counters */
+	u32 Mem[XAIETILE_PROF_MEM_CNTRS];	/**< Memory module counters */
+} XAieTile_ProfSample;
+
+/**
+ * This typedef contains the statistics of one tile over the snapshots held.
+ */
+typedef struct {
+	u64 Cycles;				/**< Timer cycles covered */
+	u64 Core[XAIETILE_PROF_CORE_CNTRS];	/**< Core module counts */
+	u64 Mem[XAIETILE_PROF_MEM_CNTRS];	/**< Memory module counts */
+	u32 CorePermille[XAIETILE_PROF_CORE_CNTRS]; /**< Core counts per 1000 cycles */
+	u32 MemPermille[XAIETILE_PROF_MEM_CNTRS]; /**< Memory counts per 1000 cycles */
+} XAieTile_ProfStats;
+
+/**
+ * This typedef contains the sampling instance. The ring holds NumSnaps
+ * snapshots of NumTiles samples each, and is allocated by the caller.
+ */
+typedef struct {
+	XAieGbl *AieInst;		/**< AIE instance, NULL for replay */
+	const XAie_LocType *Loc;	/**< Tiles of the set */
+	u32 NumTiles;			/**< Number of tiles of the set */
+	XAieTile_ProfSample *Ring;	/**< Snapshot ring */
+	u32 NumSnaps;			/**< Snapshots the ring holds */
+	u32 Head;			/**< Next snapshot to write */
+	u32 Count;			/**< Snapshots held */
+	u8 CoreMask;			/**< Core module counters used */
+	u8 MemMask;			/**< Memory module counters used */
+} XAieTile_Prof;
+
+/***************************** Macro Definitions *****************************/
+
+/************************** Function Prototypes  *****************************/
+u8 XAieTile_ProfInit(XAieTile_Prof *ProfPtr, XAieGbl *AieInst,
+		const XAie_LocType *Loc, u32 NumTiles,
+		XAieTile_ProfSample *Ring, u32 NumSnaps);
+u8 XAieTile_ProfConfigure(XAieTile_Prof *ProfPtr,
+		const XAieTile_ProfConfig *CfgPtr);
+u8 XAieTile_ProfSnapshot(XAieTile_Prof *ProfPtr);
+u8 XAieTile_ProfRecord(XAieTile_Prof *ProfPtr,
+		const XAieTile_ProfSample *Samples);
+const XAieTile_ProfSample *XAieTile_ProfGetSnapshot(XAieTile_Prof *ProfPtr,
+		u32 SnapIdx);
+void XAieTile_ProfClear(XAieTile_Prof *ProfPtr);
+u8 XAieTile_ProfGetStats(XAieTile_Prof *ProfPtr, u32 TileIdx,
+		XAieTile_ProfStats *StatsPtr);
+
+#endif		/* end of protection macro */
+/** @} */
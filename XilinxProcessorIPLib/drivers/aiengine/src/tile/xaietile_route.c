@@ -0,0 +1,585 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaietile_route.c
+* @{
+*
+* This file contains the stream switch circuit router. Routes are searched
+* breadth first over the tile grid, so each one takes the fewest tiles the
+* ports still free allow. The router keeps the routed and the programmed
+* state of every stream switch, and XAieTile_RouteCommit() only writes the
+* ports which differ.
+*
+* Only XAieTile_RouteCommit() accesses the hardware, so routes can be
+* computed without a device.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/18/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#include "xaiegbl_defs.h"
+#include "xaiegbl.h"
+#include "xaietile_strm.h"
+#include "xaietile_route.h"
+
+#include <string.h>
+
+/***************************** Include Files *********************************/
+
+/***************************** Constant Definitions **************************/
+#define XAIETILE_ROUTE_DIR_SOUTH	0U
+#define XAIETILE_ROUTE_DIR_WEST		1U
+#define XAIETILE_ROUTE_DIR_NORTH	2U
+#define XAIETILE_ROUTE_DIR_EAST		3U
+#define XAIETILE_ROUTE_NUM_DIRS		4U
+
+#define XAIETILE_ROUTE_NO_LINK		0xFFU
+#define XAIETILE_ROUTE_UNVISITED	0xFFFFU
+
+/***************************** Type Definitions ******************************/
+/*
+ * Stream switch ports connecting to the neighbour tiles, indexed by
+ * direction. Master port N of a direction feeds slave port N of the
+ * opposite direction of the neighbour.
+ */
+typedef struct {
+	u8 MstrOff[XAIETILE_ROUTE_NUM_DIRS];
+	u8 MstrCnt[XAIETILE_ROUTE_NUM_DIRS];
+	u8 SlvOff[XAIETILE_ROUTE_NUM_DIRS];
+	u8 SlvCnt[XAIETILE_ROUTE_NUM_DIRS];
+} XAieTile_RoutePorts;
+
+/************************** Variable Definitions *****************************/
+static const XAieTile_RoutePorts XAieTile_RouteTilePorts = {
+	.MstrOff = {
+		XAIETILE_TILESTRSW_MPORT_SOUTH_OFF,
+		XAIETILE_TILESTRSW_MPORT_WEST_OFF,
+		XAIETILE_TILESTRSW_MPORT_NORTH_OFF,
+		XAIETILE_TILESTRSW_MPORT_EAST_OFF,
+	},
+	.MstrCnt = {4U, 4U, 6U, 4U},
+	.SlvOff = {
+		XAIETILE_TILESTRSW_SPORT_SOUTH_OFF,
+		XAIETILE_TILESTRSW_SPORT_WEST_OFF,
+		XAIETILE_TILESTRSW_SPORT_NORTH_OFF,
+		XAIETILE_TILESTRSW_SPORT_EAST_OFF,
+	},
+	.SlvCnt = {6U, 4U, 4U, 4U},
+};
+
+static const XAieTile_RoutePorts XAieTile_RouteShimPorts = {
+	.MstrOff = {
+		XAIETILE_SHIMSTRSW_MPORT_SOUTH_OFF,
+		XAIETILE_SHIMSTRSW_MPORT_WEST_OFF,
+		XAIETILE_SHIMSTRSW_MPORT_NORTH_OFF,
+		XAIETILE_SHIMSTRSW_MPORT_EAST_OFF,
+	},
+	.MstrCnt = {6U, 4U, 6U, 4U},
+	.SlvOff = {
+		XAIETILE_SHIMSTRSW_SPORT_SOUTH_OFF,
+		XAIETILE_SHIMSTRSW_SPORT_WEST_OFF,
+		XAIETILE_SHIMSTRSW_SPORT_NORTH_OFF,
+		XAIETILE_SHIMSTRSW_SPORT_EAST_OFF,
+	},
+	.SlvCnt = {8U, 4U, 4U, 4U},
+};
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This is the internal function to return the port table of a tile.
+*
+* @param	RouterPtr - Pointer to the router instance.
+* @param	Idx - Index of the tile.
+*
+* @return	Pointer to the port table.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static const XAieTile_RoutePorts *XAieTile_RouteGetPorts(
+		XAieTile_Router *RouterPtr, u32 Idx)
+{
+	if (RouterPtr->AieInst->Tiles[Idx].TileType ==
+			XAIEGBL_TILE_TYPE_AIETILE) {
+		return &XAieTile_RouteTilePorts;
+	}
+
+	return &XAieTile_RouteShimPorts;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to return the neighbour of a tile.
+*
+* @param	RouterPtr - Pointer to the router instance.
+* @param	Idx - Index of the tile.
+* @param	Dir - Direction of the neighbour.
+* @param	NbPtr - Pointer to return the index of the neighbour.
+*
+* @return	XAIE_SUCCESS if the neighbour exists, otherwise XAIE_FAILURE.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static u8 XAieTile_RouteNeighbour(XAieTile_Router *RouterPtr, u32 Idx, u8 Dir,
+		u32 *NbPtr)
+{
+	u32 TilesPerCol = (u32)RouterPtr->AieInst->Config->NumRows + 1U;
+	u32 Col = Idx / TilesPerCol;
+	u32 Row = Idx % TilesPerCol;
+
+	switch (Dir) {
+	case XAIETILE_ROUTE_DIR_SOUTH:
+		if (Row == 0U) {
+			return XAIE_FAILURE;
+		}
+		*NbPtr = Idx - 1U;
+		break;
+	case XAIETILE_ROUTE_DIR_NORTH:
+		if ((Row + 1U) >= TilesPerCol) {
+			return XAIE_FAILURE;
+		}
+		*NbPtr = Idx + 1U;
+		break;
+	case XAIETILE_ROUTE_DIR_WEST:
+		if (Col == 0U) {
+			return XAIE_FAILURE;
+		}
+		*NbPtr = Idx - TilesPerCol;
+		break;
+	default:
+		if ((Col + 1U) >= RouterPtr->AieInst->Config->NumCols) {
+			return XAIE_FAILURE;
+		}
+		*NbPtr = Idx + TilesPerCol;
+		break;
+	}
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to find a free link from a tile to its
+* neighbour.
+*
+* @param	RouterPtr - Pointer to the router instance.
+* @param	Idx - Index of the tile.
+* @param	NbIdx - Index of the neighbour.
+* @param	Dir - Direction of the neighbour.
+*
+* @return	Index of the first free link in the direction, or
+*		XAIETILE_ROUTE_NO_LINK if all are used.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static u8 XAieTile_RouteFreeLink(XAieTile_Router *RouterPtr, u32 Idx,
+		u32 NbIdx, u8 Dir)
+{
+	const XAieTile_RoutePorts *Ports = XAieTile_RouteGetPorts(RouterPtr, Idx);
+	const XAieTile_RoutePorts *NbPorts =
+		XAieTile_RouteGetPorts(RouterPtr, NbIdx);
+	u8 Opp = (Dir + 2U) % XAIETILE_ROUTE_NUM_DIRS;
+	u8 Cnt;
+	u8 Link;
+
+	Cnt = Ports->MstrCnt[Dir];
+	if (NbPorts->SlvCnt[Opp] < Cnt) {
+		Cnt = NbPorts->SlvCnt[Opp];
+	}
+
+	for (Link = 0U; Link < Cnt; Link++) {
+		if (((RouterPtr->Tiles[Idx].MstrUsed &
+				(1U << (Ports->MstrOff[Dir] + Link))) == 0U) &&
+			((RouterPtr->Tiles[NbIdx].SlvUsed &
+				(1U << (NbPorts->SlvOff[Opp] + Link))) == 0U)) {
+			return Link;
+		}
+	}
+
+	return XAIETILE_ROUTE_NO_LINK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to return the index of a tile location.
+*
+* @param	RouterPtr - Pointer to the router instance.
+* @param	Loc - Tile location.
+* @param	IdxPtr - Pointer to return the index.
+*
+* @return	XAIE_SUCCESS if the location is in the array, otherwise
+*		XAIE_FAILURE.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static u8 XAieTile_RouteLocIdx(XAieTile_Router *RouterPtr, XAie_LocType Loc,
+		u32 *IdxPtr)
+{
+	XAieGbl_Config *CfgPtr = RouterPtr->AieInst->Config;
+
+	if ((Loc.Col >= CfgPtr->NumCols) || (Loc.Row > CfgPtr->NumRows)) {
+		return XAIE_FAILURE;
+	}
+
+	*IdxPtr = ((u32)Loc.Col * ((u32)CfgPtr->NumRows + 1U)) + Loc.Row;
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API initializes the router. No port is routed, and all the stream
+* switch ports are taken as disabled in hardware.
+*
+* @param	RouterPtr - Pointer to the router instance.
+* @param	AieInst - Pointer to the initialized AIE instance.
+* @param	Tiles - Array of XAIETILE_ROUTE_NUM_TILES() routing states.
+* @param	Prev - Array of XAIETILE_ROUTE_NUM_TILES() entries used while
+*		searching routes.
+* @param	Queue - Array of XAIETILE_ROUTE_NUM_TILES() entries used while
+*		searching routes.
+*
+* @return	XAIE_SUCCESS on success, otherwise XAIE_FAILURE.
+*
+* @note		Ports used outside of the router should be marked with
+*		XAieTile_RouteReserve().
+*
+*******************************************************************************/
+u8 XAieTile_RouterInit(XAieTile_Router *RouterPtr, XAieGbl *AieInst,
+		XAieTile_RouteTile *Tiles, u16 *Prev, u16 *Queue)
+{
+	XAie_AssertNonvoid(RouterPtr != XAIE_NULL);
+	XAie_AssertNonvoid(AieInst != XAIE_NULL);
+	XAie_AssertNonvoid(AieInst->IsReady == XAIE_COMPONENT_IS_READY);
+
+	if ((Tiles == XAIE_NULL) || (Prev == XAIE_NULL) ||
+			(Queue == XAIE_NULL) ||
+			(XAIETILE_ROUTE_NUM_TILES(AieInst) >=
+			 XAIETILE_ROUTE_UNVISITED)) {
+		return XAIE_FAILURE;
+	}
+
+	RouterPtr->AieInst = AieInst;
+	RouterPtr->Tiles = Tiles;
+	RouterPtr->Prev = Prev;
+	RouterPtr->Queue = Queue;
+
+	(void)memset(Tiles, 0, XAIETILE_ROUTE_NUM_TILES(AieInst) *
+			sizeof(*Tiles));
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API marks stream switch ports of a tile as used outside of the router.
+* They are never routed nor written by the router.
+*
+* @param	RouterPtr - Pointer to the router instance.
+* @param	Loc - Tile location.
+* @param	MstrMask - Bitmap of the master port IDs to reserve.
+* @param	SlvMask - Bitmap of the slave port IDs to reserve.
+*
+* @return	XAIE_SUCCESS on success, otherwise XAIE_FAILURE if the
+*		location is out of the array or a port is already routed.
+*
+* @note		None.
+*
+*******************************************************************************/
+u8 XAieTile_RouteReserve(XAieTile_Router *RouterPtr, XAie_LocType Loc,
+		u32 MstrMask, u32 SlvMask)
+{
+	XAieTile_RouteTile *TilePtr;
+	u32 Idx;
+
+	XAie_AssertNonvoid(RouterPtr != XAIE_NULL);
+
+	if (XAieTile_RouteLocIdx(RouterPtr, Loc, &Idx) != XAIE_SUCCESS) {
+		return XAIE_FAILURE;
+	}
+
+	TilePtr = &RouterPtr->Tiles[Idx];
+	if (((TilePtr->MstrUsed & MstrMask) != 0U) ||
+			((TilePtr->SlvUsed & SlvMask) != 0U)) {
+		return XAIE_FAILURE;
+	}
+
+	/* Routed and programmed, so the commit leaves them alone */
+	TilePtr->MstrUsed |= MstrMask;
+	TilePtr->HwMstrEn |= MstrMask;
+	TilePtr->SlvUsed |= SlvMask;
+	TilePtr->HwSlvEn |= SlvMask;
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API finds and routes a circuit switched path from a slave port of a
+* tile to a master port of a tile. The path goes through the fewest tiles
+* the free ports allow, and does not share any port with existing routes.
+*
+* @param	RouterPtr - Pointer to the router instance.
+* @param	Src - Location of the source tile.
+* @param	Slave - Slave port ID the stream enters the source tile by,
+*		ex, XAIETILE_STRSW_SPORT_DMA().
+* @param	Dst - Location of the destination tile.
+* @param	Master - Master port ID the stream leaves the destination
+*		tile by, ex, XAIETILE_STRSW_MPORT_DMA().
+* @param	RoutePtr - Pointer to return the route, to be passed to
+*		XAieTile_RouteRemove().
+*
+* @return	XAIE_SUCCESS on success, otherwise XAIE_FAILURE if a
+*		location is out of the array, an end port is already used or
+*		no path is free.
+*
+* @note		The hardware is not written until XAieTile_RouteCommit().
+*
+*******************************************************************************/
+u8 XAieTile_RouteAdd(XAieTile_Router *RouterPtr, XAie_LocType Src, u8 Slave,
+		XAie_LocType Dst, u8 Master, XAieTile_Route *RoutePtr)
+{
+	u32 TilesPerCol;
+	u32 NumTiles;
+	u32 SrcIdx, DstIdx, Idx, NbIdx;
+	u32 Head, Tail;
+	u16 NumHops;
+	u16 Hop;
+	u8 Dir, Link;
+	const XAieTile_RoutePorts *Ports;
+	XAieTile_RouteTile *TilePtr;
+
+	XAie_AssertNonvoid(RouterPtr != XAIE_NULL);
+	XAie_AssertNonvoid(RoutePtr != XAIE_NULL);
+
+	if ((XAieTile_RouteLocIdx(RouterPtr, Src, &SrcIdx) != XAIE_SUCCESS) ||
+			(XAieTile_RouteLocIdx(RouterPtr, Dst, &DstIdx) !=
+			 XAIE_SUCCESS) ||
+			(Slave >= 32U) ||
+			(Master >= XAIETILE_ROUTE_NUM_MPORTS)) {
+		return XAIE_FAILURE;
+	}
+
+	if (((RouterPtr->Tiles[SrcIdx].SlvUsed & (1U << Slave)) != 0U) ||
+			((RouterPtr->Tiles[DstIdx].MstrUsed & (1U << Master)) !=
+			 0U)) {
+		return XAIE_FAILURE;
+	}
+
+	TilesPerCol = (u32)RouterPtr->AieInst->Config->NumRows + 1U;
+	NumTiles = XAIETILE_ROUTE_NUM_TILES(RouterPtr->AieInst);
+
+	/* Breadth first search from the source over the free links */
+	for (Idx = 0U; Idx < NumTiles; Idx++) {
+		RouterPtr->Prev[Idx] = XAIETILE_ROUTE_UNVISITED;
+	}
+	RouterPtr->Prev[SrcIdx] = (u16)SrcIdx;
+	RouterPtr->Queue[0U] = (u16)SrcIdx;
+	Head = 0U;
+	Tail = 1U;
+	while ((Head < Tail) &&
+			(RouterPtr->Prev[DstIdx] == XAIETILE_ROUTE_UNVISITED)) {
+		Idx = RouterPtr->Queue[Head++];
+		for (Dir = 0U; Dir < XAIETILE_ROUTE_NUM_DIRS; Dir++) {
+			if ((XAieTile_RouteNeighbour(RouterPtr, Idx, Dir,
+					&NbIdx) != XAIE_SUCCESS) ||
+				(RouterPtr->Prev[NbIdx] !=
+				 XAIETILE_ROUTE_UNVISITED) ||
+				(XAieTile_RouteFreeLink(RouterPtr, Idx, NbIdx,
+					Dir) == XAIETILE_ROUTE_NO_LINK)) {
+				continue;
+			}
+			RouterPtr->Prev[NbIdx] = (u16)Idx;
+			RouterPtr->Queue[Tail++] = (u16)NbIdx;
+		}
+	}
+
+	if (RouterPtr->Prev[DstIdx] == XAIETILE_ROUTE_UNVISITED) {
+		return XAIE_FAILURE;
+	}
+
+	/* Walk back from the destination to size and fill the route */
+	NumHops = 1U;
+	for (Idx = DstIdx; Idx != SrcIdx; Idx = RouterPtr->Prev[Idx]) {
+		NumHops++;
+	}
+	if (NumHops > XAIETILE_ROUTE_MAX_HOPS) {
+		return XAIE_FAILURE;
+	}
+
+	Idx = DstIdx;
+	for (Hop = NumHops; Hop > 0U; Hop--) {
+		RoutePtr->Hops[Hop - 1U].Col = (u16)(Idx / TilesPerCol);
+		RoutePtr->Hops[Hop - 1U].Row = (u16)(Idx % TilesPerCol);
+		Idx = RouterPtr->Prev[Idx];
+	}
+	RoutePtr->NumHops = NumHops;
+
+	/* Pick the links between consecutive tiles */
+	RoutePtr->Hops[0U].Slave = Slave;
+	for (Hop = 0U; (Hop + 1U) < NumHops; Hop++) {
+		Idx = (RoutePtr->Hops[Hop].Col * TilesPerCol) +
+			RoutePtr->Hops[Hop].Row;
+		if (RoutePtr->Hops[Hop + 1U].Row < RoutePtr->Hops[Hop].Row) {
+			Dir = XAIETILE_ROUTE_DIR_SOUTH;
+		} else if (RoutePtr->Hops[Hop + 1U].Row >
+				RoutePtr->Hops[Hop].Row) {
+			Dir = XAIETILE_ROUTE_DIR_NORTH;
+		} else if (RoutePtr->Hops[Hop + 1U].Col <
+				RoutePtr->Hops[Hop].Col) {
+			Dir = XAIETILE_ROUTE_DIR_WEST;
+		} else {
+			Dir = XAIETILE_ROUTE_DIR_EAST;
+		}
+		(void)XAieTile_RouteNeighbour(RouterPtr, Idx, Dir, &NbIdx);
+		Link = XAieTile_RouteFreeLink(RouterPtr, Idx, NbIdx, Dir);
+
+		Ports = XAieTile_RouteGetPorts(RouterPtr, Idx);
+		RoutePtr->Hops[Hop].Master = Ports->MstrOff[Dir] + Link;
+		Ports = XAieTile_RouteGetPorts(RouterPtr, NbIdx);
+		RoutePtr->Hops[Hop + 1U].Slave =
+			Ports->SlvOff[(Dir + 2U) % XAIETILE_ROUTE_NUM_DIRS] +
+			Link;
+	}
+	RoutePtr->Hops[NumHops - 1U].Master = Master;
+
+	for (Hop = 0U; Hop < NumHops; Hop++) {
+		TilePtr = &RouterPtr->Tiles[(RoutePtr->Hops[Hop].Col *
+				TilesPerCol) + RoutePtr->Hops[Hop].Row];
+		TilePtr->MstrUsed |= 1U << RoutePtr->Hops[Hop].Master;
+		TilePtr->MstrSrc[RoutePtr->Hops[Hop].Master] =
+			RoutePtr->Hops[Hop].Slave;
+		TilePtr->SlvUsed |= 1U << RoutePtr->Hops[Hop].Slave;
+		TilePtr->Dirty = 1U;
+	}
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the ports of a route.
+*
+* @param	RouterPtr - Pointer to the router instance.
+* @param	RoutePtr - Pointer to the route returned by
+*		XAieTile_RouteAdd().
+*
+* @return	None.
+*
+* @note		The hardware is not written until XAieTile_RouteCommit(),
+*		so a route removed and added back costs no register write.
+*
+*******************************************************************************/
+void XAieTile_RouteRemove(XAieTile_Router *RouterPtr,
+		const XAieTile_Route *RoutePtr)
+{
+	XAieTile_RouteTile *TilePtr;
+	u32 TilesPerCol;
+	u16 Hop;
+
+	XAie_AssertVoid(RouterPtr != XAIE_NULL);
+	XAie_AssertVoid(RoutePtr != XAIE_NULL);
+
+	TilesPerCol = (u32)RouterPtr->AieInst->Config->NumRows + 1U;
+
+	for (Hop = 0U; Hop < RoutePtr->NumHops; Hop++) {
+		TilePtr = &RouterPtr->Tiles[(RoutePtr->Hops[Hop].Col *
+				TilesPerCol) + RoutePtr->Hops[Hop].Row];
+		TilePtr->MstrUsed &= ~(1U << RoutePtr->Hops[Hop].Master);
+		TilePtr->SlvUsed &= ~(1U << RoutePtr->Hops[Hop].Slave);
+		TilePtr->Dirty = 1U;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API programs the stream switches with the routes added and removed
+* since the last commit. Only the ports whose configuration changed are
+* written.
+*
+* @param	RouterPtr - Pointer to the router instance.
+*
+* @return	None.
+*
+* @note		Masters are disabled before the slaves which fed them.
+*
+*******************************************************************************/
+void XAieTile_RouteCommit(XAieTile_Router *RouterPtr)
+{
+	XAieTile_RouteTile *TilePtr;
+	XAieGbl_Tile *TileInstPtr;
+	u32 NumTiles;
+	u32 Idx;
+	u32 Bit;
+	u32 SlvChanged;
+	u8 Port;
+
+	XAie_AssertVoid(RouterPtr != XAIE_NULL);
+
+	NumTiles = XAIETILE_ROUTE_NUM_TILES(RouterPtr->AieInst);
+
+	for (Idx = 0U; Idx < NumTiles; Idx++) {
+		TilePtr = &RouterPtr->Tiles[Idx];
+		if (TilePtr->Dirty == 0U) {
+			continue;
+		}
+		TileInstPtr = &RouterPtr->AieInst->Tiles[Idx];
+
+		for (Port = 0U; Port < XAIETILE_ROUTE_NUM_MPORTS; Port++) {
+			Bit = 1U << Port;
+			if ((TilePtr->MstrUsed & Bit) != 0U) {
+				if (((TilePtr->HwMstrEn & Bit) == 0U) ||
+						(TilePtr->HwMstrSrc[Port] !=
+						 TilePtr->MstrSrc[Port])) {
+					XAieTile_StrmConfigMstr(TileInstPtr,
+						Port, XAIE_ENABLE, XAIE_DISABLE,
+						TilePtr->MstrSrc[Port]);
+				}
+			} else if ((TilePtr->HwMstrEn & Bit) != 0U) {
+				XAieTile_StrmConfigMstr(TileInstPtr, Port,
+					XAIE_DISABLE, XAIE_DISABLE, 0U);
+			}
+		}
+
+		SlvChanged = TilePtr->SlvUsed ^ TilePtr->HwSlvEn;
+		for (Port = 0U; SlvChanged != 0U; Port++, SlvChanged >>= 1U) {
+			if ((SlvChanged & 1U) == 0U) {
+				continue;
+			}
+			XAieTile_StrmConfigSlv(TileInstPtr, Port,
+				((TilePtr->SlvUsed & (1U << Port)) != 0U) ?
+				XAIE_ENABLE : XAIE_DISABLE, XAIE_DISABLE);
+		}
+
+		TilePtr->HwMstrEn = TilePtr->MstrUsed;
+		TilePtr->HwSlvEn = TilePtr->SlvUsed;
+		(void)memcpy(TilePtr->HwMstrSrc, TilePtr->MstrSrc,
+				sizeof(TilePtr->HwMstrSrc));
+		TilePtr->Dirty = 0U;
+	}
+}
+
+/** @} */
@@ -0,0 +1,111 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaietile_route.h
+* @{
+*
+*  Header file for the stream switch circuit router.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/18/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIETILE_ROUTE_H
+#define XAIETILE_ROUTE_H
+
+/***************************** Include Files *********************************/
+
+/***************************** Constant Definitions **************************/
+/* Most master ports of a stream switch, AIE tile has the most */
+#define XAIETILE_ROUTE_NUM_MPORTS		25U
+
+/* Most tiles a route can go through, including both ends */
+#ifndef XAIETILE_ROUTE_MAX_HOPS
+#define XAIETILE_ROUTE_MAX_HOPS			64U
+#endif
+
+/***************************** Type Definitions ******************************/
+/**
+ * This typedef contains the routing state of the stream switch of a tile.
+ */
+typedef struct {
+	u32 MstrUsed;		/**< Routed master ports */
+	u32 SlvUsed;		/**< Routed slave ports */
+	u32 HwMstrEn;		/**< Master ports enabled in hardware */
+	u32 HwSlvEn;		/**< Slave ports enabled in hardware */
+	u8 MstrSrc[XAIETILE_ROUTE_NUM_MPORTS];	/**< Slave port of each routed master */
+	u8 HwMstrSrc[XAIETILE_ROUTE_NUM_MPORTS];/**< Slave port of each enabled master */
+	u8 Dirty;		/**< Routing differs from hardware */
+} XAieTile_RouteTile;
+
+/**
+ * This typedef contains one tile of a route, with the slave port the stream
+ * enters the stream switch by and the master port it leaves by.
+ */
+typedef struct {
+	u16 Col;		/**< Column of the tile */
+	u16 Row;		/**< Row of the tile */
+	u8 Slave;		/**< Slave port ID */
+	u8 Master;		/**< Master port ID */
+} XAieTile_RouteHop;
+
+/**
+ * This typedef contains a circuit switched route.
+ */
+typedef struct {
+	XAieTile_RouteHop Hops[XAIETILE_ROUTE_MAX_HOPS]; /**< Tiles from source to destination */
+	u16 NumHops;		/**< Number of tiles used */
+} XAieTile_Route;
+
+/**
+ * This typedef contains the router instance. The arrays are allocated by the
+ * caller with one entry per tile, shim tiles included.
+ */
+typedef struct {
+	XAieGbl *AieInst;		/**< AIE instance */
+	XAieTile_RouteTile *Tiles;	/**< Routing state, same layout as the tiles of AieInst */
+	u16 *Prev;			/**< Search scratch */
+	u16 *Queue;			/**< Search scratch */
+} XAieTile_Router;
+
+/***************************** Macro Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* Macro to compute the number of entries of the arrays given to
+* XAieTile_RouterInit().
+*
+* @param	AieInstPtr - Pointer to the AIE instance.
+*
+* @return	Number of tiles of the array, shim tiles included.
+*
+* @note		None.
+*
+*******************************************************************************/
+#define XAIETILE_ROUTE_NUM_TILES(AieInstPtr)					\
+		((u32)(AieInstPtr)->Config->NumCols *				\
+		 ((u32)(AieInstPtr)->Config->NumRows + 1U))
+
+/************************** Function Prototypes  *****************************/
+u8 XAieTile_RouterInit(XAieTile_Router *RouterPtr, XAieGbl *AieInst,
+		XAieTile_RouteTile *Tiles, u16 *Prev, u16 *Queue);
+u8 XAieTile_RouteReserve(XAieTile_Router *RouterPtr, XAie_LocType Loc,
+		u32 MstrMask, u32 SlvMask);
+u8 XAieTile_RouteAdd(XAieTile_Router *RouterPtr, XAie_LocType Src, u8 Slave,
+		XAie_LocType Dst, u8 Master, XAieTile_Route *RoutePtr);
+void XAieTile_RouteRemove(XAieTile_Router *RouterPtr,
+		const XAieTile_Route *RoutePtr);
+void XAieTile_RouteCommit(XAieTile_Router *RouterPtr);
+
+#endif		/* end of protection macro */
+/** @} */
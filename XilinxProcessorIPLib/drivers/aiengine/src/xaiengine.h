@@ -18,6 +18,7 @@ extern "C" {
 #include <xaiengine/xaielib_npi.h>
 #include <xaiengine/xaiepm_clock.h>
 #include <xaiengine/xaietile_core.h>
+#include <xaiengine/xaietile_elf.h>
 #include <xaiengine/xaietile_error.h>
 #include <xaiengine/xaietile_event.h>
 #include <xaiengine/xaietile_lock.h>
@@ -26,6 +27,8 @@ extern "C" {
 #include <xaiengine/xaietile_perfcnt.h>
 #include <xaiengine/xaietile_pl.h>
 #include <xaiengine/xaietile_plif.h>
+#include <xaiengine/xaietile_prof.h>
+#include <xaiengine/xaietile_route.h>
 #include <xaiengine/xaietile_shim.h>
 #include <xaiengine/xaietile_strm.h>
 #include <xaiengine/xaietile_timer.h>
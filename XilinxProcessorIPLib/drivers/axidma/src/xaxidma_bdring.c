@@ -45,6 +45,9 @@
 *       rsp  01/17/18  Use virtual address for register read/write.
 *                      In _BdRingCreate() assign VA to BdaRestart CR#976392
 * 9.9   rsp  02/05/19  Fix XAxiDma_BdRingFromHw implementation for cyclic mode.
+* 9.16  agt  10/18/26  Do BD cache maintenance once per BD set in
+*                      XAxiDma_BdRingToHw and XAxiDma_BdRingFromHw, and added
+*                      XAxiDma_BdRingRearm to recycle processed BDs in place.
 *
 * </pre>
 ******************************************************************************/
@@ -60,6 +63,10 @@
  */
 #define XAXIDMA_STOP_TIMEOUT	500000   /* about 100 milliseconds on 100MHz */
 
+/* Number of BDs invalidated at a time while looking for completed BDs
+ */
+#define XAXIDMA_BD_REAP_BATCH	8
+
 /**************************** Type Definitions *******************************/
 
 
@@ -143,9 +150,123 @@
     }
 
 /************************** Function Prototypes ******************************/
+static void XAxiDma_BdRingCacheRange(XAxiDma_BdRing * RingPtr,
+		XAxiDma_Bd * BdSetPtr, int NumBd, int Flush);
+static void XAxiDma_BdRingUpdateTail(XAxiDma_BdRing * RingPtr);
 
 /************************** Variable Definitions *****************************/
 
+/*****************************************************************************/
+/**
+ * Flush or invalidate the cache lines of a set of adjacent BDs. The set is
+ * handled with at most two range operations, one if it does not wrap around
+ * the end of the ring.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	BdSetPtr is the first BD of the set.
+ * @param	NumBd is the number of BDs in the set.
+ * @param	Flush is non-zero to flush the set and zero to invalidate it.
+ *
+ * @return	None
+ *
+ * @note	This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+static void XAxiDma_BdRingCacheRange(XAxiDma_BdRing * RingPtr,
+		XAxiDma_Bd * BdSetPtr, int NumBd, int Flush)
+{
+	UINTPTR Addr = (UINTPTR)BdSetPtr;
+	UINTPTR Len = RingPtr->Separation * (UINTPTR)NumBd;
+	UINTPTR EndAddr = RingPtr->LastBdAddr + RingPtr->Separation;
+	UINTPTR WrapLen = 0;
+
+	if (NumBd <= 0) {
+		return;
+	}
+
+	/* Split the set if it wraps around the end of the ring */
+	if (Len > (EndAddr - Addr)) {
+		WrapLen = Len - (EndAddr - Addr);
+		Len = EndAddr - Addr;
+	}
+
+	if (Flush) {
+		XAXIDMA_CACHE_FLUSH_RANGE(Addr, Len);
+		if (WrapLen != 0) {
+			XAXIDMA_CACHE_FLUSH_RANGE(RingPtr->FirstBdAddr, WrapLen);
+		}
+	}
+	else {
+		XAXIDMA_CACHE_INVALIDATE_RANGE(Addr, Len);
+		if (WrapLen != 0) {
+			XAXIDMA_CACHE_INVALIDATE_RANGE(RingPtr->FirstBdAddr,
+						       WrapLen);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+ * Write the tail descriptor register of a running channel so that the
+ * engine processes the BDs up to RingPtr->HwTail.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ *
+ * @return	None
+ *
+ * @note	This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+static void XAxiDma_BdRingUpdateTail(XAxiDma_BdRing * RingPtr)
+{
+	int RingIndex = RingPtr->RingIndex;
+
+	if (RingPtr->RunState != AXIDMA_CHANNEL_NOT_HALTED) {
+		return;
+	}
+
+	if (RingPtr->Cyclic) {
+		XAxiDma_WriteReg(RingPtr->ChanBase,
+				 XAXIDMA_TDESC_OFFSET,
+				 (u32)XAXIDMA_VIRT_TO_PHYS(RingPtr->CyclicBd));
+		if (RingPtr->Addr_ext)
+			XAxiDma_WriteReg(RingPtr->ChanBase,
+					 XAXIDMA_TDESC_MSB_OFFSET,
+					 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->CyclicBd)));
+		return;
+	}
+
+	if (RingPtr->IsRxChannel) {
+		if (!RingIndex) {
+			XAxiDma_WriteReg(RingPtr->ChanBase,
+					XAXIDMA_TDESC_OFFSET, (XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail) & XAXIDMA_DESC_LSB_MASK));
+			if (RingPtr->Addr_ext)
+				XAxiDma_WriteReg(RingPtr->ChanBase, XAXIDMA_TDESC_MSB_OFFSET,
+						 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail)));
+		}
+		else {
+			XAxiDma_WriteReg(RingPtr->ChanBase,
+				(XAXIDMA_RX_TDESC0_OFFSET +
+				(RingIndex - 1) * XAXIDMA_RX_NDESC_OFFSET),
+				(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail) & XAXIDMA_DESC_LSB_MASK ));
+			if (RingPtr->Addr_ext)
+				XAxiDma_WriteReg(RingPtr->ChanBase,
+					(XAXIDMA_RX_TDESC0_MSB_OFFSET +
+					(RingIndex - 1) * XAXIDMA_RX_NDESC_OFFSET),
+					UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail)));
+		}
+	}
+	else {
+		XAxiDma_WriteReg(RingPtr->ChanBase,
+					XAXIDMA_TDESC_OFFSET, (XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail) & XAXIDMA_DESC_LSB_MASK));
+		if (RingPtr->Addr_ext)
+			XAxiDma_WriteReg(RingPtr->ChanBase, XAXIDMA_TDESC_MSB_OFFSET,
+						UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail)));
+	}
+}
+
 
 /*****************************************************************************/
 /**
@@ -1003,7 +1124,6 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 	int i;
 	u32 BdCr;
 	u32 BdSts;
-	int RingIndex = RingPtr->RingIndex;
 
 	if (NumBd < 0) {
 
@@ -1056,9 +1176,6 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 		BdSts &=  ~XAXIDMA_BD_STS_COMPLETE_MASK;
 		XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, BdSts);
 
-		/* Flush the current BD so DMA core could see the updates */
-		XAXIDMA_CACHE_FLUSH(CurBdPtr);
-
 		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, CurBdPtr));
 		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
 		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
@@ -1087,8 +1204,8 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 	BdSts &= ~XAXIDMA_BD_STS_COMPLETE_MASK;
 	XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, BdSts);
 
-	/* Flush the last BD so DMA core could see the updates */
-	XAXIDMA_CACHE_FLUSH(CurBdPtr);
+	/* Flush the whole set so DMA core could see the updates */
+	XAxiDma_BdRingCacheRange(RingPtr, BdSetPtr, NumBd, 1);
 	DATA_SYNC;
 
 	/* This set has completed pre-processing, adjust ring pointers and
@@ -1100,46 +1217,7 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 	RingPtr->HwCnt += NumBd;
 
 	/* If it is running, signal the engine to begin processing */
-	if (RingPtr->RunState == AXIDMA_CHANNEL_NOT_HALTED) {
-			if (RingPtr->Cyclic) {
-				XAxiDma_WriteReg(RingPtr->ChanBase,
-						 XAXIDMA_TDESC_OFFSET,
-						 (u32)XAXIDMA_VIRT_TO_PHYS(RingPtr->CyclicBd));
-				if (RingPtr->Addr_ext)
-					XAxiDma_WriteReg(RingPtr->ChanBase,
-							 XAXIDMA_TDESC_MSB_OFFSET,
-							 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->CyclicBd)));
-				return XST_SUCCESS;
-			}
-
-			if (RingPtr->IsRxChannel) {
-				if (!RingIndex) {
-					XAxiDma_WriteReg(RingPtr->ChanBase,
-							XAXIDMA_TDESC_OFFSET, (XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail) & XAXIDMA_DESC_LSB_MASK));
-					if (RingPtr->Addr_ext)
-						XAxiDma_WriteReg(RingPtr->ChanBase, XAXIDMA_TDESC_MSB_OFFSET,
-								 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail)));
-				}
-				else {
-					XAxiDma_WriteReg(RingPtr->ChanBase,
-						(XAXIDMA_RX_TDESC0_OFFSET +
-						(RingIndex - 1) * XAXIDMA_RX_NDESC_OFFSET),
-						(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail) & XAXIDMA_DESC_LSB_MASK ));
-					if (RingPtr->Addr_ext)
-						XAxiDma_WriteReg(RingPtr->ChanBase,
-							(XAXIDMA_RX_TDESC0_MSB_OFFSET +
-							(RingIndex - 1) * XAXIDMA_RX_NDESC_OFFSET),
-							UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail)));
-				}
-			}
-			else {
-				XAxiDma_WriteReg(RingPtr->ChanBase,
-							XAXIDMA_TDESC_OFFSET, (XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail) & XAXIDMA_DESC_LSB_MASK));
-				if (RingPtr->Addr_ext)
-					XAxiDma_WriteReg(RingPtr->ChanBase, XAXIDMA_TDESC_MSB_OFFSET,
-								UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail)));
-			}
-	}
+	XAxiDma_BdRingUpdateTail(RingPtr);
 
 	return XST_SUCCESS;
 }
@@ -1222,12 +1300,14 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 	XAxiDma_Bd *CurBdPtr;
 	int BdCount;
 	int BdPartialCount;
+	int BdInvalCount;
 	u32 BdSts;
 	u32 BdCr;
 
 	CurBdPtr = RingPtr->HwHead;
 	BdCount = 0;
 	BdPartialCount = 0;
+	BdInvalCount = 0;
 	BdSts = 0;
 	BdCr = 0;
 
@@ -1251,8 +1331,20 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 	 */
 
 	while (BdCount < BdLimit) {
+		/* Invalidate the next few BDs at once, they all belong to the
+		 * work group as BdLimit does not exceed HwCnt
+		 */
+		if (BdInvalCount == 0) {
+			BdInvalCount = BdLimit - BdCount;
+			if (BdInvalCount > XAXIDMA_BD_REAP_BATCH) {
+				BdInvalCount = XAXIDMA_BD_REAP_BATCH;
+			}
+			XAxiDma_BdRingCacheRange(RingPtr, CurBdPtr,
+						 BdInvalCount, 0);
+		}
+		BdInvalCount--;
+
 		/* Read the status */
-		XAXIDMA_CACHE_INVALIDATE(CurBdPtr);
 		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
 		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
 
@@ -1286,7 +1378,6 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 		if (RingPtr->Cyclic) {
 			BdSts = BdSts & ~XAXIDMA_BD_STS_COMPLETE_MASK;
 			XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, BdSts);
-			XAXIDMA_CACHE_FLUSH(CurBdPtr);
 		}
 
 		/* Reached the end of the work group */
@@ -1298,6 +1389,11 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, CurBdPtr));
 	}
 
+	/* Flush the status words cleared above for cyclic mode */
+	if (RingPtr->Cyclic) {
+		XAxiDma_BdRingCacheRange(RingPtr, RingPtr->HwHead, BdCount, 1);
+	}
+
 	/* Subtract off any partial packet BDs found */
 	BdCount -= BdPartialCount;
 
@@ -1380,6 +1476,113 @@ int XAxiDma_BdRingFree(XAxiDma_BdRing * RingPtr, int NumBd,
 
 	return XST_SUCCESS;
 }
+
+/*****************************************************************************/
+/**
+ * Give a set of BDs retrieved with XAxiDma_BdRingFromHw() straight back to
+ * hardware without changing their buffers. This is the same as calling
+ * XAxiDma_BdRingFree(), XAxiDma_BdRingAlloc() and XAxiDma_BdRingToHw() for
+ * the same BDs, but the BDs are not checked again and only their completed
+ * status bit is cleared.
+ *
+ * This is meant for streaming where every BD of the ring is given to
+ * hardware once at startup and then recycled:
+ *
+ * <pre>
+ *        NumBd = XAxiDma_BdRingFromHw(MyRingPtr, XAXIDMA_ALL_BDS, &MyBdSet);
+ *
+ *        // Consume the data of the NumBd BDs starting at MyBdSet
+ *
+ *        XAxiDma_BdRingRearm(MyRingPtr, NumBd, MyBdSet);
+ * </pre>
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	NumBd is the number of BDs to give back to hardware.
+ * @param	BdSetPtr is the head of a list of BDs returned by
+ *		XAxiDma_BdRingFromHw().
+ *
+ * @return
+ *		- XST_SUCCESS if the set of BDs was given back to hardware.
+ *		- XST_INVALID_PARAM if NumBd is negative
+ *		- XST_DMA_SG_LIST_ERROR if this function was called out of
+ *		sequence with XAxiDma_BdRingFromHw(), if there are free or
+ *		allocated BDs which would be overtaken by the set, or if the
+ *		ring is in cyclic mode.
+ *
+ * @note	This function should not be preempted by another XAxiDma
+ *		function call that modifies the BD space. It is the caller's
+ *		responsibility to ensure mutual exclusion.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingRearm(XAxiDma_BdRing * RingPtr, int NumBd,
+			XAxiDma_Bd * BdSetPtr)
+{
+	XAxiDma_Bd *CurBdPtr;
+	u32 BdSts;
+	int i;
+
+	if (NumBd < 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR,
+		    "BdRingRearm: negative BDs %d\r\n", NumBd);
+
+		return XST_INVALID_PARAM;
+	}
+
+	if (NumBd == 0) {
+		return XST_SUCCESS;
+	}
+
+	/* Make sure we are in sync with XAxiDma_BdRingFromHw(). The set
+	 * directly follows the work group only when no BDs are free or
+	 * allocated.
+	 */
+	if ((RingPtr->PostCnt < NumBd) || (RingPtr->PostHead != BdSetPtr) ||
+	    (RingPtr->FreeCnt != 0) || (RingPtr->PreCnt != 0) ||
+	    (RingPtr->Cyclic)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingRearm: Error rearm BDs: "
+		"post count %d to rearm %d, free %d, pre %d\r\n",
+			RingPtr->PostCnt, NumBd, RingPtr->FreeCnt,
+			RingPtr->PreCnt);
+
+		return XST_DMA_SG_LIST_ERROR;
+	}
+
+	/* Clear the completed status bit, the BDs are still in the cache
+	 * from XAxiDma_BdRingFromHw()
+	 */
+	CurBdPtr = BdSetPtr;
+	for (i = 0; i < NumBd; i++) {
+		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
+		BdSts &= ~XAXIDMA_BD_STS_COMPLETE_MASK;
+		XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, BdSts);
+
+		if (i < (NumBd - 1)) {
+			CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, CurBdPtr));
+		}
+	}
+
+	XAxiDma_BdRingCacheRange(RingPtr, BdSetPtr, NumBd, 1);
+	DATA_SYNC;
+
+	/* Move the set from the post-work group to the work group. The free
+	 * and pre-work groups are empty and move along with it.
+	 */
+	RingPtr->PostCnt -= NumBd;
+	RingPtr->HwCnt += NumBd;
+	RingPtr->HwTail = CurBdPtr;
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->PostHead, NumBd);
+	RingPtr->FreeHead = RingPtr->PostHead;
+	RingPtr->PreHead = RingPtr->PostHead;
+
+	XAxiDma_BdRingUpdateTail(RingPtr);
+
+	return XST_SUCCESS;
+}
 /*****************************************************************************/
 /**
  * Check the internal data structures of the BD ring for the provided channel.
@@ -34,6 +34,7 @@
 *       dc     11/19/21 Update doxygen documentation
 * 1.4   dc     08/18/22 Update IP version number
 * 1.5   dc     09/28/22 Auxiliary NCO support
+*       agt    10/18/26 Open only the named device on Linux
 *
 * </pre>
 *
@@ -49,7 +50,6 @@
 #include "xparameters.h"
 #include <metal/alloc.h>
 #else
-#include <dirent.h>
 #include <arpa/inet.h>
 #endif
 
@@ -153,131 +153,53 @@ u32 XDfeMix_GetConfigTable(XDfeMix *InstancePtr, XDfeMix_Config **ConfigTable)
 /*****************************************************************************/
 /**
 *
-* Compares two strings in the reversed order. This function compares only
-* the last "Count" number of characters of Str1Ptr and Str2Ptr.
+* Opens the device registered in "/sys/bus/platform/devices" (in Linux) with
+* the name DeviceNodeName and checks if the device is compatible with the
+* driver. Only the named device is opened, the other devices on the bus are
+* not visited.
 *
-* @param    Str1Ptr Base address of first string.
-* @param    Str2Ptr Base address of second string.
-* @param    Count Number of last characters to be compared between
-*           Str1Ptr and Str2Ptr.
-*
-* @return
-*           0 if last "Count" number of bytes matches between Str1Ptr and
-*           Str2Ptr, else difference in unmatched character.
-*
-******************************************************************************/
-static s32 XDfeMix_Strrncmp(const char *Str1Ptr, const char *Str2Ptr,
-			    size_t Count)
-{
-	u16 Len1 = strlen(Str1Ptr);
-	u16 Len2 = strlen(Str2Ptr);
-	u8 Diff;
-
-	for (; Len1 && Len2; Len1--, Len2--) {
-		if ((Diff = Str1Ptr[Len1 - 1U] - Str2Ptr[Len2 - 1U]) != 0) {
-			return Diff;
-		}
-		if (--Count == 0U) {
-			return 0;
-		}
-	}
-
-	return (Len1 - Len2);
-}
-
-/*****************************************************************************/
-/**
-*
-* Traverses "/sys/bus/platform/device" directory (in Linux), to find registered
-* device with the name DeviceNodeName.
-* If the match is found then check if the device is compatible with the driver.
-*
-* @param    DeviceNamePtr Base address of char array, where device name
-*           will be stored
-* @param    DeviceNodeName Device node name
+* @param    DevicePtr Pointer to the metal device, left open if successful.
+* @param    DeviceNodeName Device node name.
 *
 * @return
 *           - XST_SUCCESS if successful.
 *           - XST_FAILURE if device entry not found for given device id.
 *
 ******************************************************************************/
-static s32 XDfeMix_IsDeviceCompatible(char *DeviceNamePtr,
+static s32 XDfeMix_IsDeviceCompatible(struct metal_device **DevicePtr,
 				      const char *DeviceNodeName)
 {
 	char CompatibleString[256];
-	struct metal_device *DevicePtr;
-	struct dirent **DirentPtr;
-	int NumFiles;
-	u32 Status = XST_FAILURE;
-	int i = 0;
-
-	/* Make a list of files in directory in alphabetical order */
-	NumFiles = scandir(XDFEMIX_PLATFORM_DEVICE_DIR, &DirentPtr, NULL,
-			   alphasort);
-	if (NumFiles < 0) {
-		metal_log(METAL_LOG_ERROR,
-			  "\n scandir failed to open directory");
+
+	/* Open a libmetal device platform */
+	if (metal_device_open(XDFEMIX_BUS_NAME, DeviceNodeName, DevicePtr)) {
+		metal_log(METAL_LOG_ERROR, "\n Failed to open device %s",
+			  DeviceNodeName);
 		return XST_FAILURE;
 	}
 
-	/* Loop through the each device file in directory */
-	for (i = 0; i < NumFiles; i++) {
-		/* Check the string size */
-		if (strlen(DirentPtr[i]->d_name) != strlen(DeviceNodeName)) {
-			continue;
-		}
-
-		/* Check the device signature */
-		if (0 != XDfeMix_Strrncmp(DirentPtr[i]->d_name, DeviceNodeName,
-					  strlen(DeviceNodeName))) {
-			continue;
-		}
-
-		/* Open a libmetal device platform */
-		if (metal_device_open("platform", DirentPtr[i]->d_name,
-				      &DevicePtr)) {
-			metal_log(METAL_LOG_ERROR,
-				  "\n Failed to open device %s",
-				  DirentPtr[i]->d_name);
-			continue;
-		}
-
-		/* Get a "compatible" device property */
-		if (0 > metal_linux_get_device_property(
-				DevicePtr, XDFEMIX_COMPATIBLE_PROPERTY,
-				CompatibleString,
-				sizeof(CompatibleString) - 1)) {
-			metal_log(METAL_LOG_ERROR,
-				  "\n Failed to read device tree property");
-			metal_device_close(DevicePtr);
-			continue;
-		}
-
-		/* Check does "compatible" device property has name of this
-		   driver instance */
-		if (NULL ==
-		    strstr(CompatibleString, XDFEMIX_COMPATIBLE_STRING)) {
-			metal_log(
-				METAL_LOG_ERROR,
-				"No compatible property match.(Driver:%s, Device:%s)\n",
-				XDFEMIX_COMPATIBLE_STRING, CompatibleString);
-			metal_device_close(DevicePtr);
-			continue;
-		}
-
-		/* This is a requested device, save the name */
-		strcpy(DeviceNamePtr, DirentPtr[i]->d_name);
-
-		metal_device_close(DevicePtr);
-		Status = XST_SUCCESS;
-		break;
+	/* Get a "compatible" device property */
+	if (0 > metal_linux_get_device_property(
+			*DevicePtr, XDFEMIX_COMPATIBLE_PROPERTY,
+			CompatibleString, sizeof(CompatibleString) - 1)) {
+		metal_log(METAL_LOG_ERROR,
+			  "\n Failed to read device tree property");
+		metal_device_close(*DevicePtr);
+		return XST_FAILURE;
 	}
 
-	while (NumFiles--) {
-		free(DirentPtr[NumFiles]);
+	/* Check does "compatible" device property has name of this
+	   driver instance */
+	if (NULL == strstr(CompatibleString, XDFEMIX_COMPATIBLE_STRING)) {
+		metal_log(
+			METAL_LOG_ERROR,
+			"No compatible property match.(Driver:%s, Device:%s)\n",
+			XDFEMIX_COMPATIBLE_STRING, CompatibleString);
+		metal_device_close(*DevicePtr);
+		return XST_FAILURE;
 	}
-	free(DirentPtr);
-	return Status;
+
+	return XST_SUCCESS;
 }
 
 #endif
@@ -448,9 +370,6 @@ s32 XDfeMix_RegisterMetal(XDfeMix *InstancePtr, struct metal_device **DevicePtr,
 			  const char *DeviceNodeName)
 {
 	s32 Status;
-#ifndef __BAREMETAL__
-	char DeviceName[100];
-#endif
 
 	Xil_AssertNonvoid(DevicePtr != NULL);
 
@@ -466,21 +385,13 @@ s32 XDfeMix_RegisterMetal(XDfeMix *InstancePtr, struct metal_device **DevicePtr,
 		return Status;
 	}
 #else
-	/* Get device name */
-	Status = XDfeMix_IsDeviceCompatible(DeviceName, DeviceNodeName);
+	/* Open the device and check its compatibility */
+	Status = XDfeMix_IsDeviceCompatible(DevicePtr, DeviceNodeName);
 	if (Status != XST_SUCCESS) {
 		metal_log(METAL_LOG_ERROR, "\n Failed to find Mixer device %s",
 			  DeviceNodeName);
 		return Status;
 	}
-
-	/* open the device metal instance */
-	Status = metal_device_open(XDFEMIX_BUS_NAME, DeviceName, DevicePtr);
-	if (Status != XST_SUCCESS) {
-		metal_log(METAL_LOG_ERROR, "\n Failed to open device %s.\n",
-			  DeviceName);
-		return Status;
-	}
 #endif
 
 	/* Map Mixer device IO region */
@@ -33,6 +33,10 @@
  *                     XLlFifo_Initialize APIs.
  * 5.5   sk   06/15/20 In XLlFifo_iRead_Aligned and XLlFifo_iWrite_Aligned add
  *		       type casting to fix gcc warnings.
+ * 5.5   agt  10/18/26 Moved the data port selection out of the per word
+ *		       loop of XLlFifo_iRead_Aligned and XLlFifo_iWrite_Aligned
+ *		       and unrolled it. Added XLlFifo_RxGetWords and
+ *		       XLlFifo_TxPutWords.
  * </pre>
  ******************************************************************************/
 
@@ -46,6 +50,17 @@
 /************************** Constant Definitions *****************************/
 #define FIFO_WIDTH_BYTES 4
 
+/*
+ * Address of the receive and transmit data ports, on the AXI4 data interface
+ * when the core has one and in the AXI4-Lite register space otherwise.
+ */
+#define XLlFifo_RxDataAddr(InstancePtr) \
+	((InstancePtr)->Axi4BaseAddress + ((InstancePtr)->Datainterface ? \
+		XLLF_AXI4_RDFD_OFFSET : XLLF_RDFD_OFFSET))
+#define XLlFifo_TxDataAddr(InstancePtr) \
+	((InstancePtr)->Axi4BaseAddress + ((InstancePtr)->Datainterface ? \
+		XLLF_AXI4_TDFD_OFFSET : XLLF_TDFD_OFFSET))
+
 /*
  * Implementation Notes:
  *
@@ -158,6 +173,7 @@ int XLlFifo_iRead_Aligned(XLlFifo *InstancePtr, void *BufPtr,
 {
 	unsigned WordsRemaining = WordCount;
 	u32 *BufPtrIdx = (u32 *)BufPtr;
+	UINTPTR DataAddr;
 
 	xdbg_printf(XDBG_DEBUG_FIFO_RX, "XLlFifo_iRead_Aligned: start\n");
 	Xil_AssertNonvoid(InstancePtr);
@@ -166,12 +182,17 @@ int XLlFifo_iRead_Aligned(XLlFifo *InstancePtr, void *BufPtr,
 	Xil_AssertNonvoid(((UINTPTR)BufPtr & 0x3) == 0x0);
 	xdbg_printf(XDBG_DEBUG_FIFO_RX, "XLlFifo_iRead_Aligned: after asserts\n");
 
+	DataAddr = XLlFifo_RxDataAddr(InstancePtr);
+	while (WordsRemaining >= 4) {
+		BufPtrIdx[0] = Xil_In32(DataAddr);
+		BufPtrIdx[1] = Xil_In32(DataAddr);
+		BufPtrIdx[2] = Xil_In32(DataAddr);
+		BufPtrIdx[3] = Xil_In32(DataAddr);
+		BufPtrIdx += 4;
+		WordsRemaining -= 4;
+	}
 	while (WordsRemaining) {
-/*		xdbg_printf(XDBG_DEBUG_FIFO_RX,
-			    "XLlFifo_iRead_Aligned: WordsRemaining: %d\n",
-			    WordsRemaining);
-*/
-		*BufPtrIdx = XLlFifo_RxGetWord(InstancePtr);
+		*BufPtrIdx = Xil_In32(DataAddr);
 		BufPtrIdx++;
 		WordsRemaining--;
 	}
@@ -264,6 +285,7 @@ int XLlFifo_iWrite_Aligned(XLlFifo *InstancePtr, void *BufPtr,
 {
 	unsigned WordsRemaining = WordCount;
 	u32 *BufPtrIdx = (u32 *)BufPtr;
+	UINTPTR DataAddr;
 
 	xdbg_printf(XDBG_DEBUG_FIFO_TX,
 		    "XLlFifo_iWrite_Aligned: Inst: %p; Buff: %p; Count: %d\n",
@@ -276,8 +298,17 @@ int XLlFifo_iWrite_Aligned(XLlFifo *InstancePtr, void *BufPtr,
 	xdbg_printf(XDBG_DEBUG_FIFO_TX,
 		    "XLlFifo_iWrite_Aligned: WordsRemaining: %d\n",
 		    WordsRemaining);
+	DataAddr = XLlFifo_TxDataAddr(InstancePtr);
+	while (WordsRemaining >= 4) {
+		Xil_Out32(DataAddr, BufPtrIdx[0]);
+		Xil_Out32(DataAddr, BufPtrIdx[1]);
+		Xil_Out32(DataAddr, BufPtrIdx[2]);
+		Xil_Out32(DataAddr, BufPtrIdx[3]);
+		BufPtrIdx += 4;
+		WordsRemaining -= 4;
+	}
 	while (WordsRemaining) {
-		XLlFifo_TxPutWord(InstancePtr, *BufPtrIdx);
+		Xil_Out32(DataAddr, *BufPtrIdx);
 		BufPtrIdx++;
 		WordsRemaining--;
 	}
@@ -416,6 +447,83 @@ void XLlFifo_TxPutWord(XLlFifo *InstancePtr, u32 Word)
 
 }
 
+/****************************************************************************/
+/**
+*
+* XLlFifo_RxGetWords reads as many 32 bit words as the receive FIFO, specified
+* by <i>InstancePtr</i>, holds right now, up to <i>MaxWords</i>, into the
+* block of memory referenced by <i>BufPtr</i>. The occupancy is read once and
+* the words are then moved as one block, so this is the way to drain a frame
+* without checking the occupancy for every word.
+*
+* XLlFifo_RxGetLen or XLlFifo_iRxGetLen must be called before calling
+* XLlFifo_RxGetWords and <i>MaxWords</i> must not exceed the words left in
+* the frame. <i>BufPtr</i> must be 32 bit aligned.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+*
+* @param    BufPtr specifies the memory address to place the data read.
+*
+* @param    MaxWords specifies the largest number of 32 bit words to read.
+*
+* @return   XLlFifo_RxGetWords returns the number of words read, which may be
+*           zero.
+*
+*****************************************************************************/
+u32 XLlFifo_RxGetWords(XLlFifo *InstancePtr, void *BufPtr, u32 MaxWords)
+{
+	u32 Words;
+
+	Xil_AssertNonvoid(InstancePtr);
+	Xil_AssertNonvoid(BufPtr);
+	Xil_AssertNonvoid(((UINTPTR)BufPtr & 0x3) == 0x0);
+
+	Words = XLlFifo_iRxOccupancy(InstancePtr);
+	if (Words > MaxWords)
+		Words = MaxWords;
+
+	XLlFifo_iRead_Aligned(InstancePtr, BufPtr, Words);
+
+	return Words;
+}
+
+/****************************************************************************/
+/**
+*
+* XLlFifo_TxPutWords writes as many 32 bit words as the transmit FIFO,
+* specified by <i>InstancePtr</i>, has room for right now, up to
+* <i>MaxWords</i>, from the block of memory referenced by <i>BufPtr</i>. The
+* vacancy is read once and the words are then moved as one block.
+*
+* <i>BufPtr</i> must be 32 bit aligned.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+*
+* @param    BufPtr specifies the memory address of the data to write.
+*
+* @param    MaxWords specifies the largest number of 32 bit words to write.
+*
+* @return   XLlFifo_TxPutWords returns the number of words written, which may
+*           be zero.
+*
+*****************************************************************************/
+u32 XLlFifo_TxPutWords(XLlFifo *InstancePtr, void *BufPtr, u32 MaxWords)
+{
+	u32 Words;
+
+	Xil_AssertNonvoid(InstancePtr);
+	Xil_AssertNonvoid(BufPtr);
+	Xil_AssertNonvoid(((UINTPTR)BufPtr & 0x3) == 0x0);
+
+	Words = XLlFifo_iTxVacancy(InstancePtr);
+	if (Words > MaxWords)
+		Words = MaxWords;
+
+	XLlFifo_iWrite_Aligned(InstancePtr, BufPtr, Words);
+
+	return Words;
+}
+
 /*****************************************************************************/
 /**
 *
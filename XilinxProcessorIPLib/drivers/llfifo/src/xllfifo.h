@@ -162,6 +162,8 @@
  *		       Updated comments in the usage section as per example code.
  *		       Fix doxygen warnings in the driver.
  * 5.5 sd     09/04/20  Makefile update for parallel execution.
+ * 5.5 agt    10/18/26 Added XLlFifo_RxGetWords and XLlFifo_TxPutWords for
+ *		       block transfers sized to the FIFO occupancy/vacancy.
  * </pre>
  *
  *****************************************************************************/
@@ -701,6 +703,8 @@ u32 XLlFifo_iTxVacancy(XLlFifo *InstancePtr);
 void XLlFifo_iTxSetLen(XLlFifo *InstancePtr, u32 Bytes);
 u32 XLlFifo_RxGetWord(XLlFifo *InstancePtr);
 void XLlFifo_TxPutWord(XLlFifo *InstancePtr, u32 Word);
+u32 XLlFifo_RxGetWords(XLlFifo *InstancePtr, void *BufPtr, u32 MaxWords);
+u32 XLlFifo_TxPutWords(XLlFifo *InstancePtr, void *BufPtr, u32 MaxWords);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,627 @@
+/******************************************************************************
+* Copyright (C) 2022 - 2023 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xmcdma_sched.c
+* @addtogroup mcdma_v1_7
+* @{
+*
+* This file contains the implementation of the software channel manager.
+* Refer to the header file xmcdma_sched.h for more detailed information.
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.7   agt     10/18/26 First release
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xmcdma_sched.h"
+
+/************************** Constant Definitions *****************************/
+
+/* Largest quantum for which the deficit counters cannot overflow */
+#define XMCDMA_SCHED_MAX_QUANTUM	(0xFFFFFFFFU / \
+					 (4U * XMCDMA_SCHED_MAX_WEIGHT))
+
+/************************** Function Prototypes ******************************/
+
+static XMcdma_ChanCtrl *XMcdma_SchedGetChan(XMcdma_Sched *Sched, u32 Chan_id);
+static void XMcdma_SchedSetHwWeights(XMcdma_Sched *Sched);
+static u32 XMcdma_SchedDispatchChan(XMcdma_Sched *Sched, u32 Chan_id);
+static u32 XMcdma_SchedReapChan(XMcdma_Sched *Sched, u32 Chan_id);
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* Returns the MCDMA channel managed as channel Chan_id.
+*
+* @param	Sched is a pointer to the channel manager instance.
+* @param	Chan_id is the channel number, starting at 1.
+*
+* @return	Pointer to the channel.
+*
+******************************************************************************/
+static XMcdma_ChanCtrl *XMcdma_SchedGetChan(XMcdma_Sched *Sched, u32 Chan_id)
+{
+	if (Sched->Direction == XMCDMA_MEM_TO_DEV)
+		return XMcdma_GetMcdmaTxChan(Sched->InstancePtr, Chan_id);
+
+	return XMcdma_GetMcdmaRxChan(Sched->InstancePtr, Chan_id);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a channel manager for one direction of an MCDMA
+* core. No channel is managed until it is given a weight with
+* XMcdma_SchedSetChanWeight().
+*
+* @param	Sched is a pointer to the channel manager instance.
+* @param	InstancePtr is a pointer to the initialized XMcdma instance.
+* @param	Direction is XMCDMA_MEM_TO_DEV for the MM2S channels or
+*		XMCDMA_DEV_TO_MEM for the S2MM channels.
+* @param	Quantum is the number of bytes a channel of weight 1 may
+*		submit per dispatch round.
+* @param	TimeFn returns the time stamps for the latency counters. It
+*		can be NULL if latency is not needed.
+*
+* @return
+*		- XST_SUCCESS if initialization was successful.
+*		- XST_INVALID_PARAM if the core has no channels in Direction
+*		or Quantum is out of range.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XMcdma_SchedInit(XMcdma_Sched *Sched, XMcdma *InstancePtr,
+		     u32 Direction, u32 Quantum, XMcdma_SchedTimeFn TimeFn)
+{
+	u32 NumChans;
+
+	Xil_AssertNonvoid(Sched != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (Direction == XMCDMA_MEM_TO_DEV) {
+		if (!InstancePtr->Config.HasMM2S)
+			return XST_INVALID_PARAM;
+		NumChans = (u32)InstancePtr->Config.TxNumChannels;
+	} else if (Direction == XMCDMA_DEV_TO_MEM) {
+		if (!InstancePtr->Config.HasS2MM)
+			return XST_INVALID_PARAM;
+		NumChans = (u32)InstancePtr->Config.RxNumChannels;
+	} else {
+		return XST_INVALID_PARAM;
+	}
+
+	if ((NumChans == 0) || (Quantum == 0) ||
+	    (Quantum > XMCDMA_SCHED_MAX_QUANTUM))
+		return XST_INVALID_PARAM;
+
+	if (NumChans > XMCDMA_SCHED_MAX_CHAN)
+		NumChans = XMCDMA_SCHED_MAX_CHAN;
+
+	memset((void *)Sched, 0, sizeof(XMcdma_Sched));
+	Sched->InstancePtr = InstancePtr;
+	Sched->Direction = Direction;
+	Sched->NumChans = NumChans;
+	Sched->Quantum = Quantum;
+	Sched->TimeFn = TimeFn;
+
+	XMcdma_SchedResetStats(Sched);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets the target share of bandwidth of a channel. Over time
+* each channel submits a number of bytes proportional to its weight. For
+* MM2S the weights of all managed channels are also programmed into the
+* hardware WRR registers, scaled so that the largest weight maps to 15.
+*
+* @param	Sched is a pointer to the channel manager instance.
+* @param	Chan_id is the channel number, starting at 1.
+* @param	Weight is the relative weight from 1 to XMCDMA_SCHED_MAX_WEIGHT,
+*		or 0 to stop managing an idle channel.
+*
+* @return
+*		- XST_SUCCESS if the weight is set.
+*		- XST_INVALID_PARAM if Chan_id or Weight is out of range.
+*		- XST_DEVICE_BUSY if Weight is 0 and the channel still has
+*		requests.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XMcdma_SchedSetChanWeight(XMcdma_Sched *Sched, u32 Chan_id, u32 Weight)
+{
+	XMcdma_SchedChan *SchedChan;
+
+	Xil_AssertNonvoid(Sched != NULL);
+
+	if ((Chan_id == 0) || (Chan_id > Sched->NumChans) ||
+	    (Weight > XMCDMA_SCHED_MAX_WEIGHT))
+		return XST_INVALID_PARAM;
+
+	SchedChan = &Sched->Chan[Chan_id - 1];
+	if ((Weight == 0) &&
+	    ((SchedChan->InFlightCnt != 0) || (SchedChan->QueuedCnt != 0)))
+		return XST_DEVICE_BUSY;
+
+	SchedChan->Weight = Weight;
+	SchedChan->Deficit = 0;
+
+	if (Sched->Direction == XMCDMA_MEM_TO_DEV)
+		XMcdma_SchedSetHwWeights(Sched);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Programs the MM2S WRR weights from the weights of the managed channels.
+*
+* @param	Sched is a pointer to the channel manager instance.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XMcdma_SchedSetHwWeights(XMcdma_Sched *Sched)
+{
+	u32 MaxWeight = 0;
+	u32 HwWeight;
+	u32 i;
+
+	for (i = 0; i < Sched->NumChans; i++) {
+		if (Sched->Chan[i].Weight > MaxWeight)
+			MaxWeight = Sched->Chan[i].Weight;
+	}
+
+	if (MaxWeight == 0)
+		return;
+
+	for (i = 0; i < Sched->NumChans; i++) {
+		if (Sched->Chan[i].Weight == 0)
+			continue;
+
+		HwWeight = (Sched->Chan[i].Weight * XMCDMA_SCHED_HW_MAX_WEIGHT +
+			    (MaxWeight / 2)) / MaxWeight;
+		if (HwWeight == 0)
+			HwWeight = 1;
+
+		(void)XMCdma_SetChan_Weight(XMcdma_SchedGetChan(Sched, i + 1),
+					    (u8)HwWeight);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets the callback called for every completed request.
+*
+* @param	Sched is a pointer to the channel manager instance.
+* @param	Handler is the callback, or NULL for none.
+* @param	CallBackRef is passed to the callback.
+*
+* @return	None.
+*
+******************************************************************************/
+void XMcdma_SchedSetDoneHandler(XMcdma_Sched *Sched,
+				XMcdma_SchedDoneHandler Handler,
+				void *CallBackRef)
+{
+	Xil_AssertVoid(Sched != NULL);
+
+	Sched->DoneHandler = Handler;
+	Sched->DoneRef = CallBackRef;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues a transfer request on a channel. The request is given
+* to hardware by a later XMcdma_SchedDispatch() call. For MM2S each request
+* is sent as one packet.
+*
+* Cache maintenance of the buffer is left to the caller, as for
+* XMcDma_ChanSubmit().
+*
+* @param	Sched is a pointer to the channel manager instance.
+* @param	Chan_id is the channel number, starting at 1.
+* @param	BufAddr is the buffer address.
+* @param	Len is the length of the transfer in bytes.
+*
+* @return
+*		- XST_SUCCESS if the request is queued.
+*		- XST_INVALID_PARAM if the channel is not managed, Len is 0
+*		or Len needs more BDs than the BD ring of the channel has.
+*		- XST_DEVICE_BUSY if the channel queue is full.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XMcdma_SchedQueue(XMcdma_Sched *Sched, u32 Chan_id, UINTPTR BufAddr,
+		      u32 Len)
+{
+	XMcdma_SchedChan *SchedChan;
+	XMcdma_SchedReq *Req;
+	XMcdma_ChanCtrl *Chan;
+	u32 BdNeeded;
+	u32 Index;
+
+	Xil_AssertNonvoid(Sched != NULL);
+
+	if ((Chan_id == 0) || (Chan_id > Sched->NumChans) || (Len == 0))
+		return XST_INVALID_PARAM;
+
+	SchedChan = &Sched->Chan[Chan_id - 1];
+	if (SchedChan->Weight == 0)
+		return XST_INVALID_PARAM;
+
+	/* A request must fit in the ring, or it would never be dispatched */
+	Chan = XMcdma_SchedGetChan(Sched, Chan_id);
+	if ((Chan->Separation == 0) || (Chan->MaxTransferLen == 0))
+		return XST_INVALID_PARAM;
+
+	BdNeeded = (Len / Chan->MaxTransferLen) +
+		   (((Len % Chan->MaxTransferLen) != 0U) ? 1U : 0U);
+	if (BdNeeded > (Chan->Length / (u32)Chan->Separation))
+		return XST_INVALID_PARAM;
+
+	if ((SchedChan->InFlightCnt + SchedChan->QueuedCnt) >=
+	    XMCDMA_SCHED_QUEUE_DEPTH)
+		return XST_DEVICE_BUSY;
+
+	Index = (SchedChan->Head + SchedChan->InFlightCnt +
+		 SchedChan->QueuedCnt) % XMCDMA_SCHED_QUEUE_DEPTH;
+	Req = &SchedChan->Req[Index];
+	Req->BufAddr = BufAddr;
+	Req->Len = Len;
+	Req->BdLeft = 0;
+	Req->BytesDone = 0;
+	Req->Status = 0;
+	Req->SubmitTime = 0;
+
+	SchedChan->QueuedCnt++;
+	SchedChan->Stats.ReqQueued++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs one deficit round robin round over the managed
+* channels. Each channel with queued requests is credited its weight times
+* the quantum and submits requests while its credit covers them and it has
+* free BDs. The round starts one channel further each time.
+*
+* @param	Sched is a pointer to the channel manager instance.
+*
+* @return	The number of requests given to hardware.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XMcdma_SchedDispatch(XMcdma_Sched *Sched)
+{
+	u32 Submitted = 0;
+	u32 i;
+
+	Xil_AssertNonvoid(Sched != NULL);
+
+	for (i = 0; i < Sched->NumChans; i++) {
+		Submitted += XMcdma_SchedDispatchChan(Sched,
+				((Sched->NextChan + i) % Sched->NumChans) + 1);
+	}
+
+	Sched->NextChan = (Sched->NextChan + 1) % Sched->NumChans;
+
+	return Submitted;
+}
+
+/*****************************************************************************/
+/**
+*
+* Dispatches the queued requests of one channel for the current round.
+*
+* @param	Sched is a pointer to the channel manager instance.
+* @param	Chan_id is the channel number, starting at 1.
+*
+* @return	The number of requests given to hardware.
+*
+******************************************************************************/
+static u32 XMcdma_SchedDispatchChan(XMcdma_Sched *Sched, u32 Chan_id)
+{
+	XMcdma_SchedChan *SchedChan = &Sched->Chan[Chan_id - 1];
+	XMcdma_ChanCtrl *Chan;
+	XMcdma_SchedReq *Req = NULL;
+	XMcdma_Bd *FirstBd;
+	u32 Credit;
+	u32 BdNeeded;
+	u32 Submitted = 0;
+	u32 Status;
+
+	if (SchedChan->QueuedCnt == 0)
+		return 0;
+
+	Chan = XMcdma_SchedGetChan(Sched, Chan_id);
+	Credit = SchedChan->Weight * Sched->Quantum;
+	SchedChan->Deficit += Credit;
+
+	while (SchedChan->QueuedCnt != 0) {
+		Req = &SchedChan->Req[(SchedChan->Head + SchedChan->InFlightCnt) %
+				      XMCDMA_SCHED_QUEUE_DEPTH];
+		if (Req->Len > SchedChan->Deficit)
+			break;
+
+		BdNeeded = (Req->Len + (Chan->MaxTransferLen - 1)) /
+			   Chan->MaxTransferLen;
+		if (BdNeeded > Chan->BdCnt)
+			break;
+
+		FirstBd = Chan->BdRestart;
+		Status = XMcDma_ChanSubmit(Chan, Req->BufAddr, Req->Len);
+		if (Status != XST_SUCCESS)
+			break;
+
+		/* Send each request as one packet */
+		if (!Chan->IsRxChan) {
+			if (FirstBd == Chan->BdTail) {
+				XMcDma_BdSetCtrl(FirstBd,
+						 XMCDMA_BD_CTRL_SOF_MASK |
+						 XMCDMA_BD_CTRL_EOF_MASK);
+			} else {
+				XMcDma_BdSetCtrl(FirstBd,
+						 XMCDMA_BD_CTRL_SOF_MASK);
+				XMcDma_BdSetCtrl(Chan->BdTail,
+						 XMCDMA_BD_CTRL_EOF_MASK);
+				XMCDMA_CACHE_FLUSH((UINTPTR)(Chan->BdTail));
+			}
+			XMCDMA_CACHE_FLUSH((UINTPTR)(FirstBd));
+		}
+
+		Req->BdLeft = BdNeeded;
+		if (Sched->TimeFn != NULL)
+			Req->SubmitTime = Sched->TimeFn();
+
+		SchedChan->Deficit -= Req->Len;
+		SchedChan->InFlightCnt++;
+		SchedChan->QueuedCnt--;
+		SchedChan->Stats.ReqSubmitted++;
+		Submitted++;
+	}
+
+	if (SchedChan->QueuedCnt == 0) {
+		/* An idle channel does not keep its credit */
+		SchedChan->Deficit = 0;
+	} else if ((Req != NULL) && (Req->Len <= SchedChan->Deficit)) {
+		/* Out of BDs, only keep what the next round needs */
+		if (Credit < Req->Len)
+			Credit = Req->Len;
+		if (SchedChan->Deficit > Credit)
+			SchedChan->Deficit = Credit;
+	}
+
+	if (Submitted != 0) {
+		DATA_SYNC;
+		Status = XMcDma_ChanToHw(Chan);
+		if (Status != XST_SUCCESS)
+			xil_printf("XMcDma_ChanToHw failed for Channel %d\n\r",
+				   (int)Chan_id);
+		Sched->InFlightMask |= (1U << (Chan_id - 1));
+	}
+
+	return Submitted;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reaps the completed requests of all channels flagged in the
+* channel serviced register in one pass, updates the channel counters and
+* calls the done handler for each completed request. If none of the channels
+* with requests in flight is flagged, all of them are checked, so that
+* completions are not missed when the register reads back empty.
+*
+* @param	Sched is a pointer to the channel manager instance.
+*
+* @return	The number of completed requests.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XMcdma_SchedReap(XMcdma_Sched *Sched)
+{
+	UINTPTR BaseAddress;
+	u32 Serviced;
+	u32 Mask;
+	u32 Done = 0;
+	u32 Chan_id;
+
+	Xil_AssertNonvoid(Sched != NULL);
+
+	BaseAddress = Sched->InstancePtr->Config.BaseAddress;
+	if (Sched->Direction == XMCDMA_MEM_TO_DEV)
+		Serviced = XMcdma_ReadReg(BaseAddress, XMCDMA_TXCH_SERV_OFFSET);
+	else
+		Serviced = XMcdma_ReadReg(BaseAddress, XMCDMA_RX_OFFSET +
+					  XMCDMA_RXCH_SER_OFFSET);
+
+	Mask = Serviced & Sched->InFlightMask;
+	if (Mask == 0)
+		Mask = Sched->InFlightMask;
+
+	for (Chan_id = 1; Mask != 0; Chan_id++, Mask >>= 1) {
+		if (Mask & 1U)
+			Done += XMcdma_SchedReapChan(Sched, Chan_id);
+	}
+
+	return Done;
+}
+
+/*****************************************************************************/
+/**
+*
+* Reaps the completed BDs of one channel and completes the requests they
+* belong to.
+*
+* @param	Sched is a pointer to the channel manager instance.
+* @param	Chan_id is the channel number, starting at 1.
+*
+* @return	The number of completed requests.
+*
+******************************************************************************/
+static u32 XMcdma_SchedReapChan(XMcdma_Sched *Sched, u32 Chan_id)
+{
+	XMcdma_SchedChan *SchedChan = &Sched->Chan[Chan_id - 1];
+	XMcdma_SchedStats *Stats = &SchedChan->Stats;
+	XMcdma_ChanCtrl *Chan;
+	XMcdma_SchedReq *Req;
+	XMcdma_Bd *BdSetPtr;
+	XMcdma_Bd *BdPtr;
+	u64 Latency;
+	u32 Sts;
+	u32 Bytes;
+	u32 Done = 0;
+	int BdCount;
+	int i;
+
+	Chan = XMcdma_SchedGetChan(Sched, Chan_id);
+	BdCount = XMcdma_BdChainFromHW(Chan, Chan->BdSubmitCnt, &BdSetPtr);
+	if (BdCount <= 0)
+		return 0;
+
+	BdPtr = BdSetPtr;
+	for (i = 0; (i < BdCount) && (SchedChan->InFlightCnt != 0); i++) {
+		Req = &SchedChan->Req[SchedChan->Head];
+
+		if (Chan->IsRxChan) {
+			Sts = XMcDma_BdGetSts(BdPtr);
+			Bytes = XMcDma_BdGetActualLength(BdPtr,
+							 Chan->MaxTransferLen);
+		} else {
+			Sts = XMcDma_TxBdGetSts(BdPtr);
+			Bytes = XMcdma_BdRead(BdPtr, XMCDMA_BD_CTRL_OFFSET) &
+				Chan->MaxTransferLen;
+		}
+
+		Req->Status |= Sts & XMCDMA_BD_STS_ALL_ERR_MASK;
+		Req->BytesDone += Bytes;
+		Req->BdLeft--;
+		Stats->BdDone++;
+
+		if (Req->BdLeft == 0) {
+			Stats->ReqDone++;
+			Stats->BytesDone += Req->BytesDone;
+			if (Req->Status != 0)
+				Stats->ReqErrors++;
+
+			if (Sched->TimeFn != NULL) {
+				Latency = Sched->TimeFn() - Req->SubmitTime;
+				if ((Stats->ReqDone == 1) ||
+				    (Latency < Stats->LatencyMin))
+					Stats->LatencyMin = Latency;
+				if (Latency > Stats->LatencyMax)
+					Stats->LatencyMax = Latency;
+				Stats->LatencySum += Latency;
+			}
+
+			SchedChan->Head = (SchedChan->Head + 1) %
+					  XMCDMA_SCHED_QUEUE_DEPTH;
+			SchedChan->InFlightCnt--;
+			Done++;
+
+			if (Sched->DoneHandler != NULL)
+				Sched->DoneHandler(Sched->DoneRef, Chan_id,
+						   Req->BufAddr, Req->BytesDone,
+						   (Req->Status != 0) ?
+						   XST_DMA_ERROR : XST_SUCCESS);
+		}
+
+		BdPtr = (XMcdma_Bd *)XMcdma_BdChainNextBd(Chan, BdPtr);
+	}
+
+	(void)XMcdma_BdChainFree(Chan, BdCount, BdSetPtr);
+
+	if (SchedChan->InFlightCnt == 0)
+		Sched->InFlightMask &= ~(1U << (Chan_id - 1));
+
+	return Done;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns a copy of the counters of a channel. The average
+* latency is LatencySum / ReqDone and the throughput is BytesDone over the
+* time elapsed since StartTime.
+*
+* @param	Sched is a pointer to the channel manager instance.
+* @param	Chan_id is the channel number, starting at 1.
+* @param	StatsPtr is where the counters are copied to.
+*
+* @return
+*		- XST_SUCCESS if the counters are copied.
+*		- XST_INVALID_PARAM if Chan_id is out of range.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XMcdma_SchedGetStats(XMcdma_Sched *Sched, u32 Chan_id,
+			 XMcdma_SchedStats *StatsPtr)
+{
+	Xil_AssertNonvoid(Sched != NULL);
+	Xil_AssertNonvoid(StatsPtr != NULL);
+
+	if ((Chan_id == 0) || (Chan_id > Sched->NumChans))
+		return XST_INVALID_PARAM;
+
+	*StatsPtr = Sched->Chan[Chan_id - 1].Stats;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function clears the counters of all channels and sets their start
+* time to now.
+*
+* @param	Sched is a pointer to the channel manager instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XMcdma_SchedResetStats(XMcdma_Sched *Sched)
+{
+	u64 Now = 0;
+	u32 i;
+
+	Xil_AssertVoid(Sched != NULL);
+
+	if (Sched->TimeFn != NULL)
+		Now = Sched->TimeFn();
+
+	for (i = 0; i < XMCDMA_SCHED_MAX_CHAN; i++) {
+		memset((void *)&Sched->Chan[i].Stats, 0,
+		       sizeof(XMcdma_SchedStats));
+		Sched->Chan[i].Stats.StartTime = Now;
+	}
+}
+/** @} */
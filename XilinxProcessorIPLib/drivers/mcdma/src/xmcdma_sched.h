@@ -0,0 +1,168 @@
+/******************************************************************************
+* Copyright (C) 2022 - 2023 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xmcdma_sched.h
+* @addtogroup mcdma_v1_7
+* @{
+*
+* This file contains the software channel manager of the MCDMA driver.
+*
+* The channel manager keeps a small queue of transfer requests per channel
+* and hands them to the channel BD chains by deficit round robin, so that
+* over time every channel gets the share of bytes given by its weight,
+* whatever the sizes of its requests. For MM2S the same weights are also
+* programmed, scaled to 1..15, into the hardware WRR registers.
+*
+* Completed requests of all channels flagged in the channel serviced
+* register are reaped in one call, and per channel counters of requests,
+* bytes, errors and request latency are kept.
+*
+* Typical use:
+* <pre>
+*	XMcdma_SchedInit(&Sched, &McDma, XMCDMA_MEM_TO_DEV, 4096, NULL);
+*	XMcdma_SchedSetChanWeight(&Sched, 1, 8);
+*	XMcdma_SchedSetChanWeight(&Sched, 2, 1);
+*	XMcdma_SchedSetDoneHandler(&Sched, DoneHandler, &AppData);
+*
+*	XMcdma_SchedQueue(&Sched, 1, Buf1, Len1);
+*	XMcdma_SchedQueue(&Sched, 2, Buf2, Len2);
+*
+*	while (...) {
+*		XMcdma_SchedDispatch(&Sched);
+*		XMcdma_SchedReap(&Sched);
+*	}
+* </pre>
+*
+* The BD chains of the managed channels must be created with
+* XMcDma_ChanBdCreate() before use and must not be used directly while they
+* are managed. Like the rest of the driver, the channel manager is not
+* thread safe.
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.7   agt     10/18/26 First release
+*
+******************************************************************************/
+#ifndef XMCDMA_SCHED_H_
+#define XMCDMA_SCHED_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xmcdma.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XMCDMA_SCHED_MAX_CHAN		16	/**< Channels per direction */
+#define XMCDMA_SCHED_QUEUE_DEPTH	16	/**< Queued and in flight
+						  *  requests per channel */
+#define XMCDMA_SCHED_MAX_WEIGHT		255	/**< Largest channel weight */
+#define XMCDMA_SCHED_HW_MAX_WEIGHT	0xF	/**< Largest hardware WRR
+						  *  weight */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Time stamp source for the latency counters, in any monotonic unit.
+ */
+typedef u64 (*XMcdma_SchedTimeFn) (void);
+
+/**
+ * Called for every completed request. Status is XST_SUCCESS or XST_DMA_ERROR
+ * and Len is the number of bytes moved.
+ */
+typedef void (*XMcdma_SchedDoneHandler) (void *CallBackRef, u32 Chan_id,
+					 UINTPTR BufAddr, u32 Len, s32 Status);
+
+/**
+ * Per channel counters.
+ */
+typedef struct {
+	u32 ReqQueued;		/**< Requests accepted by XMcdma_SchedQueue */
+	u32 ReqSubmitted;	/**< Requests given to hardware */
+	u32 ReqDone;		/**< Requests completed */
+	u32 ReqErrors;		/**< Requests completed with an error */
+	u32 BdDone;		/**< BDs completed */
+	u64 BytesDone;		/**< Bytes moved by completed requests */
+	u64 LatencySum;		/**< Sum of request latencies */
+	u64 LatencyMin;		/**< Smallest request latency */
+	u64 LatencyMax;		/**< Largest request latency */
+	u64 StartTime;		/**< Time stamp of the last stats reset */
+} XMcdma_SchedStats;
+
+/**
+ * Request queued on or in flight on a channel.
+ */
+typedef struct {
+	UINTPTR BufAddr;	/**< Buffer address */
+	u32 Len;		/**< Requested length in bytes */
+	u32 BdLeft;		/**< BDs not yet completed */
+	u32 BytesDone;		/**< Bytes moved so far */
+	u32 Status;		/**< OR of the BD error bits */
+	u64 SubmitTime;		/**< Time stamp of the hardware submission */
+} XMcdma_SchedReq;
+
+/**
+ * Per channel state of the channel manager. Req[] is a ring holding the
+ * in flight requests followed by the queued ones.
+ */
+typedef struct {
+	u32 Weight;		/**< Relative share of bandwidth, 0 if the
+				  *  channel is not managed */
+	u32 Deficit;		/**< Bytes the channel may still submit */
+	XMcdma_SchedReq Req[XMCDMA_SCHED_QUEUE_DEPTH];
+	u32 Head;		/**< Oldest in flight or queued request */
+	u32 InFlightCnt;	/**< Requests given to hardware */
+	u32 QueuedCnt;		/**< Requests waiting for dispatch */
+	XMcdma_SchedStats Stats;
+} XMcdma_SchedChan;
+
+/**
+ * Channel manager instance, one per direction of an MCDMA core.
+ */
+typedef struct {
+	XMcdma *InstancePtr;	/**< MCDMA core */
+	u32 Direction;		/**< XMCDMA_MEM_TO_DEV or XMCDMA_DEV_TO_MEM */
+	u32 NumChans;		/**< Channels in this direction */
+	u32 Quantum;		/**< Bytes credited per round and weight */
+	u32 NextChan;		/**< Channel the next round starts at */
+	u32 InFlightMask;	/**< Channels with requests in flight,
+				  *  bit 0 is channel 1 */
+	XMcdma_SchedTimeFn TimeFn;
+	XMcdma_SchedDoneHandler DoneHandler;
+	void *DoneRef;
+	XMcdma_SchedChan Chan[XMCDMA_SCHED_MAX_CHAN];
+} XMcdma_Sched;
+
+/************************** Function Prototypes ******************************/
+
+s32 XMcdma_SchedInit(XMcdma_Sched *Sched, XMcdma *InstancePtr,
+		     u32 Direction, u32 Quantum, XMcdma_SchedTimeFn TimeFn);
+s32 XMcdma_SchedSetChanWeight(XMcdma_Sched *Sched, u32 Chan_id, u32 Weight);
+void XMcdma_SchedSetDoneHandler(XMcdma_Sched *Sched,
+				XMcdma_SchedDoneHandler Handler,
+				void *CallBackRef);
+s32 XMcdma_SchedQueue(XMcdma_Sched *Sched, u32 Chan_id, UINTPTR BufAddr,
+		      u32 Len);
+u32 XMcdma_SchedDispatch(XMcdma_Sched *Sched);
+u32 XMcdma_SchedReap(XMcdma_Sched *Sched);
+s32 XMcdma_SchedGetStats(XMcdma_Sched *Sched, u32 Chan_id,
+			 XMcdma_SchedStats *StatsPtr);
+void XMcdma_SchedResetStats(XMcdma_Sched *Sched);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XMCDMA_SCHED_H_ */
+/** @} */
@@ -90,6 +90,8 @@
 * 1.10  akm    01/05/22    Remove assert checks form static and internal APIs.
 * 1.11  akm    03/31/22    Fix unused parameter warning.
 * 1.11  akm    03/31/22    Fix misleading-indentation warning.
+* 1.11  agt    10/18/26    Skip runs of bad blocks in XNandPsu_Read and
+*                          XNandPsu_Write with XNandPsu_NextGoodBlock.
 *
 * </pre>
 *
@@ -1447,7 +1449,9 @@ s32 XNandPsu_Write(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *SrcBuf)
 		 * a block boundary.
 		 */
 		if (XNandPsu_IsBlockBad(InstancePtr, Block) == XST_SUCCESS) {
-			OffsetVar += (u64)InstancePtr->Geometry.BlockSize;
+			OffsetVar += (u64)(XNandPsu_NextGoodBlock(InstancePtr,
+					Block) - Block) *
+					(u64)InstancePtr->Geometry.BlockSize;
 			continue;
 		}
 		/* Calculate Page and Column address values */
@@ -1562,7 +1566,9 @@ s32 XNandPsu_Read(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *DestBuf)
 		 * writing always at a block boundary and skip blocks if any.
 		 */
 		if (XNandPsu_IsBlockBad(InstancePtr, Block) == XST_SUCCESS) {
-			OffsetVar += (u64)InstancePtr->Geometry.BlockSize;
+			OffsetVar += (u64)(XNandPsu_NextGoodBlock(InstancePtr,
+					Block) - Block) *
+					(u64)InstancePtr->Geometry.BlockSize;
 			continue;
 		}
 		/* Calculate Page and Column address values */
@@ -154,6 +154,7 @@
 * 1.10  akm    01/05/22    Remove assert checks form static and internal APIs.
 * 1.11  akm    03/31/22    Fix unused parameter warning.
 * 1.11  akm    03/31/22    Fix misleading-indentation warning.
+* 1.11  agt    10/18/26    Added one bit per block bad block bitmap.
 *
 * </pre>
 *
@@ -398,6 +399,9 @@ typedef struct {
 	XNandPsu_BadBlockPattern BbPattern;	/**< Bad block pattern to
 						  search */
 	u8 Bbt[XNANDPSU_MAX_BLOCKS >> 2];	/**< Bad block table array */
+	u32 BbtBitmap[XNANDPSU_MAX_BLOCKS >> 5];	/**< One bit per block,
+							  set if the block is
+							  bad */
 } XNandPsu;
 
 /******************* Macro Definitions (Inline Functions) *******************/
@@ -29,6 +29,9 @@
 *	                   data access.
 * 1.4	nsk    04/10/18    Added ICCARM compiler support.
 * 1.10	akm    01/05/22    Remove assert checks form static and internal APIs.
+* 1.11	agt    10/18/26    Keep a one bit per block bad block bitmap for
+*			   XNandPsu_IsBlockBad and added XNandPsu_NextGoodBlock
+*			   and XNandPsu_CountBadBlocks.
 * </pre>
 *
 ******************************************************************************/
@@ -64,6 +67,8 @@ static s32 XNandPsu_MarkBbt(XNandPsu* InstancePtr, XNandPsu_BbtDesc *Desc,
 
 static s32 XNandPsu_UpdateBbt(XNandPsu *InstancePtr, u32 Target);
 
+static void XNandPsu_BuildBbtBitmap(XNandPsu *InstancePtr);
+
 /************************** Variable Definitions *****************************/
 
 /*****************************************************************************/
@@ -304,9 +309,42 @@ s32 XNandPsu_ScanBbt(XNandPsu *InstancePtr)
 
 	Status = XST_SUCCESS;
 Out:
+	XNandPsu_BuildBbtBitmap(InstancePtr);
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* This function builds the bad block bitmap from the RAM based Bad Block
+* Table(BBT). Bad and factory marked bad blocks are set in the bitmap, good
+* and reserved blocks are not.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+*
+* @return
+*		- NONE.
+*
+******************************************************************************/
+static void XNandPsu_BuildBbtBitmap(XNandPsu *InstancePtr)
+{
+	u32 Block;
+	u8 BlockType;
+
+	(void)memset(&InstancePtr->BbtBitmap[0], 0,
+			sizeof(InstancePtr->BbtBitmap));
+
+	for (Block = 0U; Block < InstancePtr->Geometry.NumBlocks; Block++) {
+		BlockType = (InstancePtr->Bbt[Block >> XNANDPSU_BBT_BLOCK_SHIFT]
+				>> XNandPsu_BbtBlockShift(Block)) &
+				XNANDPSU_BLOCK_TYPE_MASK;
+		if ((BlockType == XNANDPSU_BLOCK_BAD) ||
+			(BlockType == XNANDPSU_BLOCK_FACTORY_BAD)) {
+			InstancePtr->BbtBitmap[Block >> XNANDPSU_BBT_BITMAP_SHIFT]
+				|= (u32)1U << (Block & XNANDPSU_BBT_BITMAP_MASK);
+		}
+	}
+}
+
 /*****************************************************************************/
 /**
 * This function converts the Bad Block Table(BBT) read from the flash to the
@@ -836,19 +874,10 @@ s32 XNandPsu_IsBlockBad(XNandPsu *InstancePtr, u32 Block)
 	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY)
 	Xil_AssertNonvoid(Block < InstancePtr->Geometry.NumBlocks);
 
-	u8 Data;
-	u8 BlockShift;
-	u8 BlockType;
-	u32 BlockOffset;
 	s32 Status;
 
-	BlockOffset = Block >> XNANDPSU_BBT_BLOCK_SHIFT;
-	BlockShift = XNandPsu_BbtBlockShift(Block);
-	Data = InstancePtr->Bbt[BlockOffset];	/* Block information in BBT */
-	BlockType = (Data >> BlockShift) & XNANDPSU_BLOCK_TYPE_MASK;
-
-	if ((BlockType != XNANDPSU_BLOCK_GOOD) &&
-		(BlockType != XNANDPSU_BLOCK_RESERVED)) {
+	if ((InstancePtr->BbtBitmap[Block >> XNANDPSU_BBT_BITMAP_SHIFT] &
+		((u32)1U << (Block & XNANDPSU_BBT_BITMAP_MASK))) != 0U) {
 		Status = XST_SUCCESS;
 	}
 	else {
@@ -857,6 +886,90 @@ s32 XNandPsu_IsBlockBad(XNandPsu *InstancePtr, u32 Block)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* This function returns the first good block at or after a block. Runs of 32
+* good or bad blocks are checked with a single bitmap word access.
+*
+* @param	InstancePtr is the pointer to the XNandPsu instance.
+* @param	Block is the block number to start from.
+*
+* @return
+*		- The first good block number, or the total number of blocks
+*		  if there is no good block left.
+*
+******************************************************************************/
+u32 XNandPsu_NextGoodBlock(XNandPsu *InstancePtr, u32 Block)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY)
+
+	u32 NumBlocks = InstancePtr->Geometry.NumBlocks;
+	u32 Current = Block;
+	u32 Word;
+
+	while (Current < NumBlocks) {
+		Word = InstancePtr->BbtBitmap[Current >> XNANDPSU_BBT_BITMAP_SHIFT]
+			>> (Current & XNANDPSU_BBT_BITMAP_MASK);
+		if ((Word & 1U) == 0U) {
+			break;
+		}
+		if (Word == (0xFFFFFFFFU >> (Current & XNANDPSU_BBT_BITMAP_MASK))) {
+			/* Rest of this word is bad, go to the next one */
+			Current = (Current | XNANDPSU_BBT_BITMAP_MASK) + 1U;
+		}
+		else {
+			Current++;
+		}
+	}
+
+	return (Current < NumBlocks) ? Current : NumBlocks;
+}
+
+/*****************************************************************************/
+/**
+* This function counts the bad blocks in a range of blocks.
+*
+* @param	InstancePtr is the pointer to the XNandPsu instance.
+* @param	Block is the first block of the range.
+* @param	NumBlocks is the number of blocks in the range.
+*
+* @return
+*		- The number of bad blocks in the range.
+*
+******************************************************************************/
+u32 XNandPsu_CountBadBlocks(XNandPsu *InstancePtr, u32 Block, u32 NumBlocks)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY)
+	Xil_AssertNonvoid(NumBlocks <= InstancePtr->Geometry.NumBlocks);
+	Xil_AssertNonvoid(Block <= (InstancePtr->Geometry.NumBlocks -
+								NumBlocks));
+
+	u32 Current = Block;
+	u32 End = Block + NumBlocks;
+	u32 Bits;
+	u32 Word;
+	u32 Count = 0U;
+
+	while (Current < End) {
+		Word = InstancePtr->BbtBitmap[Current >> XNANDPSU_BBT_BITMAP_SHIFT]
+			>> (Current & XNANDPSU_BBT_BITMAP_MASK);
+		Bits = 32U - (Current & XNANDPSU_BBT_BITMAP_MASK);
+		if (Bits > (End - Current)) {
+			Bits = End - Current;
+			Word &= ((u32)1U << Bits) - 1U;
+		}
+		while (Word != 0U) {
+			Word &= Word - 1U;
+			Count++;
+		}
+		Current += Bits;
+	}
+
+	return Count;
+}
+
 /*****************************************************************************/
 /**
 * This function marks a block as bad in the RAM based Bad Block Table(BBT). It
@@ -896,6 +1009,8 @@ s32 XNandPsu_MarkBlockBad(XNandPsu *InstancePtr, u32 Block)
 	Data |= (XNANDPSU_BLOCK_BAD << BlockShift);
 	NewVal = Data;
 	InstancePtr->Bbt[BlockOffset] = Data;
+	InstancePtr->BbtBitmap[Block >> XNANDPSU_BBT_BITMAP_SHIFT] |=
+			(u32)1U << (Block & XNANDPSU_BBT_BITMAP_MASK);
 
 	/* Update the Bad Block Table(BBT) in flash */
 	if (OldVal != NewVal) {
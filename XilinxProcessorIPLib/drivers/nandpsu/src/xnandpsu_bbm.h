@@ -52,6 +52,11 @@
 * XNandPsu_IsBlockBad and take the action based on the return value. Also user
 * can update the bad block table using XNandPsu_MarkBlockBad API.
 *
+* The bad blocks are also kept in a bitmap with one bit per block, which is
+* what XNandPsu_IsBlockBad looks at. XNandPsu_NextGoodBlock and
+* XNandPsu_CountBadBlocks use it to skip over 32 good or bad blocks at a time
+* when walking large sequential images.
+*
 * @note		None
 *
 * <pre>
@@ -64,6 +69,8 @@
 *			   in page section by enabling XNANDPSU_BBT_NO_OOB.
 *			   Modified Bbt Signature and Version Offset value for
 *			   Oob and No-Oob region.
+* 1.11  agt    10/18/2026  Added bad block bitmap, XNandPsu_NextGoodBlock and
+*			   XNandPsu_CountBadBlocks.
 * </pre>
 *
 ******************************************************************************/
@@ -115,6 +122,12 @@ extern "C" {
 
 #define XNANDPSU_BBT_BLOCK_SHIFT		2U	/**< Block shift value
 							  for a block in BBT */
+#define XNANDPSU_BBT_BITMAP_SHIFT		5U	/**< Block shift value
+							  for a block in the
+							  bad block bitmap */
+#define XNANDPSU_BBT_BITMAP_MASK		0x1FU	/**< Bit of a block in
+							  a bad block bitmap
+							  word */
 #define XNANDPSU_BBT_ENTRY_NUM_BLOCKS		4U	/**< Num of blocks in
 							  one BBT entry */
 #define XNANDPSU_BB_PTRN_OFF_SML_PAGE	5U	/**< Bad block pattern
@@ -172,6 +185,10 @@ void XNandPsu_InitBbtDesc(XNandPsu *InstancePtr);
 
 s32 XNandPsu_IsBlockBad(XNandPsu *InstancePtr, u32 Block);
 
+u32 XNandPsu_NextGoodBlock(XNandPsu *InstancePtr, u32 Block);
+
+u32 XNandPsu_CountBadBlocks(XNandPsu *InstancePtr, u32 Block, u32 NumBlocks);
+
 #ifdef __cplusplus
 }
 #endif
@@ -42,6 +42,7 @@
 * 1.6   sk   02/07/22 Replaced driver version in addtogroup with Overview.
 * 1.8   sk   11/11/22 Enable Master DLL mode by default for Versal Net.
 *       sk   11/29/22 Added support for Indirect Non-Dma write.
+* 1.8   agt  10/18/26 Added XOspiPsv_StreamStart() and XOspiPsv_StreamNext().
 *
 * </pre>
 *
@@ -63,6 +64,8 @@
  */
 #define XOSPIPSV_TAP_GRAN_SEL_MIN_FREQ	120000000U
 #define READ_ID		0x9FU	/**< Read Id opcode */
+#define XOSPIPSV_STREAM_DMA_DELAY_CNT	10000000U /**< Max stream window DMA
+						    *  delay count */
 
 /**************************** Type Definitions *******************************/
 
@@ -73,6 +76,8 @@
 static inline void XOspiPsv_AssertCS(const XOspiPsv *InstancePtr);
 static inline void XOspiPsv_DeAssertCS(const XOspiPsv *InstancePtr);
 static inline void StubStatusHandler(void *CallBackRef, u32 StatusEvent);
+static u32 XOspiPsv_StreamIssue(XOspiPsv *InstancePtr, XOspiPsv_Stream *Stream,
+		u8 Index);
 
 /************************** Variable Definitions *****************************/
 
@@ -1001,6 +1006,230 @@ void XOspiPsv_SetStatusHandler(XOspiPsv *InstancePtr, void *CallBackRef,
 	InstancePtr->StatusRef = CallBackRef;
 }
 
+/*****************************************************************************/
+/**
+* @brief
+* This function starts a streaming read of Length bytes from flash. The read
+* command, address, dummy cycles and protocol are taken from ReadMsg, which
+* must describe an addressed read. The data is returned window by window by
+* XOspiPsv_StreamNext().
+*
+* In INDAC mode the windows are read by DMA and the DMA of the next window
+* runs while the caller consumes the current one. In DAC mode the windows are
+* copied from the linear address space, and the read instruction is programmed
+* once at the start of the stream, and again only if another transfer is done
+* between two windows.
+*
+* @param	InstancePtr is a pointer to the XOspiPsv instance.
+* @param	Stream is a pointer to the stream state.
+* @param	ReadMsg is a pointer to the read command, ReadMsg->Addr is the
+*		flash address of the first byte.
+* @param	Length is the number of bytes to read.
+* @param	Buf0 is the first window buffer.
+* @param	Buf1 is the second window buffer.
+* @param	WindowSize is the size of each window buffer in bytes, a
+*		multiple of 4.
+*
+* @return
+*		- XST_SUCCESS if the read of the first window is started.
+*		- XST_INVALID_PARAM if an argument is not supported.
+*		- XST_DEVICE_BUSY if a transfer is already in progress.
+*		- XST_FAILURE if the transfer fails.
+*
+******************************************************************************/
+u32 XOspiPsv_StreamStart(XOspiPsv *InstancePtr, XOspiPsv_Stream *Stream,
+		const XOspiPsv_Msg *ReadMsg, u32 Length, u8 *Buf0, u8 *Buf1,
+		u32 WindowSize)
+{
+	u32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Stream != NULL);
+	Xil_AssertNonvoid(ReadMsg != NULL);
+	Xil_AssertNonvoid(Buf0 != NULL);
+	Xil_AssertNonvoid(Buf1 != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if ((ReadMsg->Flags != XOSPIPSV_MSG_FLAG_RX) ||
+			(ReadMsg->Addrvalid == 0U) || (ReadMsg->Xfer64bit != 0U) ||
+			(Length == 0U) || (WindowSize == 0U) ||
+			((WindowSize % 4U) != 0U)) {
+		Status = (u32)XST_INVALID_PARAM;
+		goto ERROR_PATH;
+	}
+
+	if ((InstancePtr->OpMode == XOSPIPSV_DAC_MODE) &&
+			((ReadMsg->Addr >= SIZE_512MB) ||
+			(Length > (SIZE_512MB - ReadMsg->Addr)))) {
+		Status = (u32)XST_INVALID_PARAM;
+		goto ERROR_PATH;
+	}
+
+	if (InstancePtr->IsBusy == (u32)TRUE) {
+		Status = (u32)XST_DEVICE_BUSY;
+		goto ERROR_PATH;
+	}
+
+	/*
+	 * Make the first window program the read in DAC mode, also when the
+	 * same stream state was used for an earlier read.
+	 */
+	InstancePtr->Msg = NULL;
+
+	Stream->Msg = *ReadMsg;
+	Stream->Addr = ReadMsg->Addr;
+	Stream->BytesLeft = Length;
+	Stream->WindowSize = WindowSize;
+	Stream->Window[0] = Buf0;
+	Stream->Window[1] = Buf1;
+	Stream->WindowLen[1] = 0U;
+	Stream->Out = 0U;
+	Stream->InFlight = (u8)FALSE;
+
+	Status = XOspiPsv_StreamIssue(InstancePtr, Stream, 0U);
+
+ERROR_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function returns the next window of a streaming read and starts the
+* read of the window after it. The returned data stays valid until the next
+* call.
+*
+* @param	InstancePtr is a pointer to the XOspiPsv instance.
+* @param	Stream is a pointer to the stream state.
+* @param	DataPtr is filled with the address of the window data.
+* @param	DataLen is filled with the number of bytes in the window.
+*
+* @return
+*		- XST_SUCCESS if a window is returned.
+*		- XST_NO_DATA if the whole stream has been returned.
+*		- XST_FAILURE if the transfer fails.
+*
+******************************************************************************/
+u32 XOspiPsv_StreamNext(XOspiPsv *InstancePtr, XOspiPsv_Stream *Stream,
+		u8 **DataPtr, u32 *DataLen)
+{
+	u32 Status;
+	u8 Done;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Stream != NULL);
+	Xil_AssertNonvoid(DataPtr != NULL);
+	Xil_AssertNonvoid(DataLen != NULL);
+
+	Done = Stream->Out;
+	if (Stream->WindowLen[Done] == 0U) {
+		Status = (u32)XST_NO_DATA;
+		goto ERROR_PATH;
+	}
+
+	if (Stream->InFlight == (u8)TRUE) {
+		Stream->InFlight = (u8)FALSE;
+		if (Xil_WaitForEvent(InstancePtr->Config.BaseAddress +
+				XOSPIPSV_OSPIDMA_DST_I_STS,
+				XOSPIPSV_OSPIDMA_DST_I_STS_DONE_MASK,
+				XOSPIPSV_OSPIDMA_DST_I_STS_DONE_MASK,
+				XOSPIPSV_STREAM_DMA_DELAY_CNT) != (u32)XST_SUCCESS) {
+			XOspiPsv_DeAssertCS(InstancePtr);
+			InstancePtr->IsBusy = (u32)FALSE;
+			Status = (u32)XST_FAILURE;
+			goto ERROR_PATH;
+		}
+		Status = XOspiPsv_CheckDmaDone(InstancePtr);
+		if (Status != (u32)XST_SUCCESS) {
+			goto ERROR_PATH;
+		}
+	}
+
+	*DataPtr = Stream->Window[Done];
+	*DataLen = Stream->WindowLen[Done];
+	Stream->WindowLen[Done] = 0U;
+	Stream->Out = Done ^ 1U;
+
+	Status = (u32)XST_SUCCESS;
+	if (Stream->BytesLeft != 0U) {
+		Status = XOspiPsv_StreamIssue(InstancePtr, Stream, Stream->Out);
+	}
+
+ERROR_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function reads the next window of a streaming read into a window
+* buffer. In INDAC mode the DMA is only started, except for a last window
+* which is not a multiple of 4 bytes long and is read in polled mode.
+*
+* @param	InstancePtr is a pointer to the XOspiPsv instance.
+* @param	Stream is a pointer to the stream state.
+* @param	Index is the window buffer to fill.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_DEVICE_BUSY if a transfer is already in progress.
+*		- XST_FAILURE if the transfer fails.
+*
+******************************************************************************/
+static u32 XOspiPsv_StreamIssue(XOspiPsv *InstancePtr, XOspiPsv_Stream *Stream,
+		u8 Index)
+{
+	u32 Status;
+	u32 Len;
+
+	Len = (Stream->BytesLeft < Stream->WindowSize) ?
+			Stream->BytesLeft : Stream->WindowSize;
+
+	if (InstancePtr->OpMode == XOSPIPSV_DAC_MODE) {
+		if (InstancePtr->IsBusy == (u32)TRUE) {
+			Status = (u32)XST_DEVICE_BUSY;
+			goto ERROR_PATH;
+		}
+		/* Reprogram the read only if another message was sent since */
+		if (InstancePtr->Msg != &Stream->Msg) {
+			XOspiPsv_Setup_Devsize(InstancePtr, &Stream->Msg);
+			XOspiPsv_Setup_Dev_Read_Instr_Reg(InstancePtr,
+					&Stream->Msg);
+			InstancePtr->Msg = &Stream->Msg;
+		}
+		XOspiPsv_AssertCS(InstancePtr);
+		Xil_MemCpy(Stream->Window[Index],
+			(const void *)(UINTPTR)(XOSPIPSV_LINEAR_ADDR_BASE +
+					Stream->Addr), Len);
+		XOspiPsv_DeAssertCS(InstancePtr);
+		Status = (u32)XST_SUCCESS;
+	} else {
+		Stream->Msg.Addr = Stream->Addr;
+		Stream->Msg.ByteCount = Len;
+		Stream->Msg.RxBfrPtr = Stream->Window[Index];
+		if ((Len % 4U) == 0U) {
+			Status = XOspiPsv_StartDmaTransfer(InstancePtr,
+					&Stream->Msg);
+			if (Status == (u32)XST_SUCCESS) {
+				Stream->InFlight = (u8)TRUE;
+			}
+		} else {
+			Status = XOspiPsv_PollTransfer(InstancePtr,
+					&Stream->Msg);
+		}
+	}
+	if (Status != (u32)XST_SUCCESS) {
+		goto ERROR_PATH;
+	}
+
+	Stream->WindowLen[Index] = Len;
+	Stream->Addr += Len;
+	Stream->BytesLeft -= Len;
+
+ERROR_PATH:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief
@@ -84,6 +84,7 @@
 *                     safety guidelines for CCM metric.
 * 1.8   sk   11/11/22 Enable Master DLL mode by default for Versal Net.
 *       sk   11/29/22 Added support for Indirect Non-Dma write.
+* 1.8   agt  10/18/26 Added double buffered streaming read API.
 *
 * </pre>
 *
@@ -188,6 +189,23 @@ typedef struct {
 #endif
 } XOspiPsv;
 
+/**
+ * This typedef contains the state of a streaming read. The flash is read in
+ * windows of WindowSize bytes into two buffers used in turn, so that one
+ * window can be consumed while the next one is read.
+ */
+typedef struct {
+	XOspiPsv_Msg Msg;	/**< Read command, updated for each window */
+	u32 Addr;		/**< Flash address of the next window */
+	u32 BytesLeft;		/**< Bytes not yet requested from flash */
+	u32 WindowSize;		/**< Bytes per window, multiple of 4 */
+	u8 *Window[2];		/**< Window buffers */
+	u32 WindowLen[2];	/**< Bytes held by each window, 0 if none */
+	u8 Out;			/**< Window returned by the next
+				  *  XOspiPsv_StreamNext() call */
+	u8 InFlight;		/**< DMA into Window[Out] is in progress */
+} XOspiPsv_Stream;
+
 /************************** Variable Definitions *****************************/
 extern XOspiPsv_Config XOspiPsv_ConfigTable[];
 
@@ -426,6 +444,11 @@ u32 XOspiPsv_StartDmaTransfer(XOspiPsv *InstancePtr, XOspiPsv_Msg *Msg);
 u32 XOspiPsv_CheckDmaDone(XOspiPsv *InstancePtr);
 u32 XOspiPsv_SetDllDelay(XOspiPsv *InstancePtr);
 u32 XOspiPsv_ConfigDualByteOpcode(XOspiPsv *InstancePtr, u8 Enable);
+u32 XOspiPsv_StreamStart(XOspiPsv *InstancePtr, XOspiPsv_Stream *Stream,
+		const XOspiPsv_Msg *ReadMsg, u32 Length, u8 *Buf0, u8 *Buf1,
+		u32 WindowSize);
+u32 XOspiPsv_StreamNext(XOspiPsv *InstancePtr, XOspiPsv_Stream *Stream,
+		u8 **DataPtr, u32 *DataLen);
 #ifdef __cplusplus
 }
 #endif
@@ -171,6 +171,8 @@
  * 1.17 akm 10/31/22 Add support for Winbond flash w25q02nw.
  * 1.17 akm 12/16/22 Add timeout in QSPIPSU driver operation.
  * 1.17 akm 01/02/23 Use Xil_WaitForEvent() API for register bit polling.
+ * 1.17 agt 10/18/26 Added XQspiPsu_StreamRead() for stacked and parallel
+ *		     aware sequential reads.
  *
  * </pre>
  *
@@ -277,6 +279,37 @@ typedef struct {
 	void *StatusRef;	/**< Callback reference for status handler */
 } XQspiPsu;
 
+/**
+ * Time stamp source of a streaming read, in microseconds.
+ */
+typedef u64 (*XQspiPsu_StreamTimeFn) (void);
+
+/**
+ * This typedef contains the read command and flash geometry of a streaming
+ * read, see XQspiPsu_StreamRead().
+ */
+typedef struct {
+	u8 Cmd;		/**< Read opcode */
+	u8 AddrBytes;	/**< Address bytes, 3 or 4 */
+	u8 DummyCycles;	/**< Dummy clocks, 0 if none */
+	u8 BusWidth;	/**< XQSPIPSU_SELECT_MODE_* of dummy and data */
+	u32 DevSize;	/**< Size of one flash device in bytes */
+	u32 DieSize;	/**< Size of one die, a multiple of 4, DevSize
+			     *  for a single die flash */
+	XQspiPsu_StreamTimeFn TimeFn; /**< Time source for the statistics,
+					*  may be NULL */
+} XQspiPsu_StreamCfg;
+
+/**
+ * This typedef contains the statistics of a streaming read.
+ */
+typedef struct {
+	u32 Bytes;	/**< Bytes read */
+	u32 Commands;	/**< Read commands issued */
+	u64 ElapsedUs;	/**< Duration, 0 without time source */
+	u32 MBps;	/**< Achieved rate in MB/s, 0 without time source */
+} XQspiPsu_StreamStats;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /**
@@ -542,6 +575,11 @@ s32 XQspiPsu_StartDmaTransfer(XQspiPsu *InstancePtr, XQspiPsu_Msg *Msg,
 				u32 NumMsg);
 s32 XQspiPsu_CheckDmaDone(XQspiPsu *InstancePtr);
 
+/* Streaming read */
+s32 XQspiPsu_StreamRead(XQspiPsu *InstancePtr, const XQspiPsu_StreamCfg *Cfg,
+		u32 Addr, u8 *RxBfrPtr, u32 ByteCount,
+		XQspiPsu_StreamStats *Stats);
+
 /* Configuration functions */
 s32 XQspiPsu_SetClkPrescaler(const XQspiPsu *InstancePtr, u8 Prescaler);
 void XQspiPsu_SelectFlash(XQspiPsu *InstancePtr, u8 FlashCS, u8 FlashBus);
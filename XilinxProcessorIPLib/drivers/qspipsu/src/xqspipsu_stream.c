@@ -0,0 +1,684 @@
+/******************************************************************************
+* Copyright (c) 2022 - 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+ *
+ * @file xqspipsu_stream.c
+ * @addtogroup qspipsu Overview
+ * @{
+ *
+ * The xqspipsu_stream.c file contains the streaming read of the QSPIPSU
+ * driver.
+ *
+ * XQspiPsu_StreamRead() reads a range of the flash address space seen by the
+ * application, which in stacked mode covers the lower and then the upper
+ * flash and in parallel mode is striped over both flashes. The range is split
+ * into one read command per die, each read by a single DMA transfer.
+ *
+ * The command, address and dummy GENFIFO entries of a command are queued
+ * while the DMA of the previous command is still running, so the next data
+ * phase starts as soon as the previous DMA is done instead of after a full
+ * command setup.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who Date     Changes
+ * ----- --- -------- -----------------------------------------------
+ * 1.17  agt 10/18/26 First release
+ * </pre>
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xqspipsu.h"
+#include "xqspipsu_control.h"
+
+/************************** Constant Definitions *****************************/
+#define XQSPIPSU_STREAM_DELAY_CNT	1000000000U	/**< Max delay count */
+#define XQSPIPSU_STREAM_3B_ADDR_MAX	0x1000000U	/**< Flash size reachable
+							  *  with 3 byte addresses */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * The part of a streaming read which is read by a single command.
+ */
+typedef struct {
+	u8 FlashCS;	/**< XQSPIPSU_SELECT_FLASH_CS_* */
+	u8 FlashBus;	/**< XQSPIPSU_SELECT_FLASH_BUS_* */
+	u32 FlashAddr;	/**< Address sent to the flash */
+	u32 Len;	/**< Bytes of the application buffer read */
+} XQspiPsu_StreamSeg;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static s32 XQspiPsu_StreamCheck(const XQspiPsu *InstancePtr,
+		const XQspiPsu_StreamCfg *Cfg, u32 Addr, const u8 *RxBfrPtr,
+		u32 ByteCount);
+static void XQspiPsu_StreamGetSeg(const XQspiPsu *InstancePtr,
+		const XQspiPsu_StreamCfg *Cfg, u32 Addr, u32 Left,
+		XQspiPsu_StreamSeg *Seg);
+static s32 XQspiPsu_StreamPush(const XQspiPsu *InstancePtr, u32 Entry);
+static s32 XQspiPsu_StreamCmd(const XQspiPsu *InstancePtr,
+		const XQspiPsu_StreamCfg *Cfg, u32 FlashAddr);
+static s32 XQspiPsu_StreamData(XQspiPsu *InstancePtr,
+		const XQspiPsu_StreamCfg *Cfg, XQspiPsu_Msg *Msg);
+static s32 XQspiPsu_StreamWaitDma(const XQspiPsu *InstancePtr,
+		const XQspiPsu_Msg *Msg);
+static s32 XQspiPsu_StreamDrain(const XQspiPsu *InstancePtr,
+		const XQspiPsu_Msg *Pending);
+static s32 XQspiPsu_StreamTail(XQspiPsu *InstancePtr,
+		const XQspiPsu_StreamCfg *Cfg, const XQspiPsu_StreamSeg *Seg,
+		u8 *RxBfrPtr);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * This function reads ByteCount bytes from the flash address Addr into
+ * RxBfrPtr.
+ *
+ * In stacked mode, addresses from Cfg->DevSize onwards are read from the
+ * upper flash. In parallel mode, Addr is the address in the striped flash
+ * space and each flash is read at Addr / 2. A new read command is issued
+ * at every die boundary.
+ *
+ * The command opcode and address are sent in SPI mode, the dummy cycles and
+ * data in the mode given by Cfg->BusWidth. The flash must already be in the
+ * addressing mode matching Cfg->AddrBytes.
+ *
+ * @param	InstancePtr is a pointer to the XQspiPsu instance.
+ * @param	Cfg is a pointer to the read command and flash geometry.
+ * @param	Addr is the flash address of the first byte, word aligned.
+ * @param	RxBfrPtr is the destination buffer, word aligned.
+ * @param	ByteCount is the number of bytes to read.
+ * @param	Stats is filled with the statistics of the read, may be NULL.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_INVALID_PARAM if the configuration, range or buffer
+ *		  is not supported.
+ *		- XST_DEVICE_BUSY if a transfer is already in progress.
+ *		- XST_FAILURE if the driver is not in DMA read mode or the
+ *		  transfer times out.
+ *
+ * @note	After a timeout the controller is left busy and must be
+ *		recovered with XQspiPsu_Abort().
+ *
+ ******************************************************************************/
+s32 XQspiPsu_StreamRead(XQspiPsu *InstancePtr, const XQspiPsu_StreamCfg *Cfg,
+		u32 Addr, u8 *RxBfrPtr, u32 ByteCount,
+		XQspiPsu_StreamStats *Stats)
+{
+	XQspiPsu_StreamSeg Seg;
+	XQspiPsu_Msg DataMsg[2];
+	XQspiPsu_Msg *Pending = NULL;
+	u8 *BfrPtr = RxBfrPtr;
+	u32 CurAddr = Addr;
+	u32 Left = ByteCount;
+	u32 Done = 0U;
+	u32 Commands = 0U;
+	u32 Slot = 0U;
+	u64 StartTime = 0U;
+	u64 Elapsed;
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Cfg != NULL);
+	Xil_AssertNonvoid(RxBfrPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	Status = XQspiPsu_StreamCheck(InstancePtr, Cfg, Addr, RxBfrPtr,
+			ByteCount);
+	if (Status != (s32)XST_SUCCESS) {
+		goto END;
+	}
+	/*
+	 * Check whether there is another transfer in progress.
+	 * Not thread-safe
+	 */
+	if (InstancePtr->IsBusy == (u32)TRUE) {
+		Status = (s32)XST_DEVICE_BUSY;
+		goto END;
+	}
+	if (InstancePtr->ReadMode != XQSPIPSU_READMODE_DMA) {
+		Status = (s32)XST_FAILURE;
+		goto END;
+	}
+
+	if (Cfg->TimeFn != NULL) {
+		StartTime = Cfg->TimeFn();
+	}
+
+	InstancePtr->IsBusy = (u32)TRUE;
+#if defined  (XCLOCKING)
+	Xil_ClockEnable(InstancePtr->Config.RefClk);
+#endif
+
+	while (Left != 0U) {
+		XQspiPsu_StreamGetSeg(InstancePtr, Cfg, CurAddr, Left, &Seg);
+		if (((Seg.Len % 4U) != 0U) || (Seg.Len < 8U)) {
+			/*
+			 * A command too short for the DMA, ex. the last word
+			 * before a die boundary, is read in IO mode once the
+			 * queued commands are done.
+			 */
+			Status = XQspiPsu_StreamDrain(InstancePtr, Pending);
+			if (Status != (s32)XST_SUCCESS) {
+				goto END;
+			}
+			Pending = NULL;
+			InstancePtr->IsBusy = (u32)FALSE;
+			Status = XQspiPsu_StreamTail(InstancePtr, Cfg, &Seg,
+					BfrPtr);
+			if (Status != (s32)XST_SUCCESS) {
+				goto END;
+			}
+			InstancePtr->IsBusy = (u32)TRUE;
+		} else {
+			/*
+			 * Queue the command of this segment behind the data
+			 * of the previous one, then program the DMA once the
+			 * previous one is done.
+			 */
+			XQspiPsu_SelectFlash(InstancePtr, Seg.FlashCS,
+					Seg.FlashBus);
+			Status = XQspiPsu_StreamCmd(InstancePtr, Cfg,
+					Seg.FlashAddr);
+			if (Status != (s32)XST_SUCCESS) {
+				goto END;
+			}
+			XQspiPsu_ManualStartEnable(InstancePtr);
+
+			if (Pending != NULL) {
+				Status = XQspiPsu_StreamWaitDma(InstancePtr,
+						Pending);
+				if (Status != (s32)XST_SUCCESS) {
+					goto END;
+				}
+			}
+
+			DataMsg[Slot].TxBfrPtr = NULL;
+			DataMsg[Slot].RxBfrPtr = BfrPtr;
+			DataMsg[Slot].ByteCount = Seg.Len;
+			DataMsg[Slot].BusWidth = Cfg->BusWidth;
+			DataMsg[Slot].Flags = XQSPIPSU_MSG_FLAG_RX;
+			DataMsg[Slot].RxAddr64bit = 0U;
+			DataMsg[Slot].Xfer64bit = 0U;
+			Status = XQspiPsu_StreamData(InstancePtr, Cfg,
+					&DataMsg[Slot]);
+			if (Status != (s32)XST_SUCCESS) {
+				goto END;
+			}
+			Status = XQspiPsu_StreamPush(InstancePtr,
+					XQSPIPSU_GENFIFO_MODE_SPI |
+					InstancePtr->GenFifoBus |
+					XQSPIPSU_GENFIFO_CS_HOLD);
+			if (Status != (s32)XST_SUCCESS) {
+				goto END;
+			}
+			XQspiPsu_ManualStartEnable(InstancePtr);
+
+			Pending = &DataMsg[Slot];
+			Slot ^= 1U;
+		}
+
+		Commands++;
+		CurAddr += Seg.Len;
+		BfrPtr += Seg.Len;
+		Left -= Seg.Len;
+		Done += Seg.Len;
+	}
+
+	Status = XQspiPsu_StreamDrain(InstancePtr, Pending);
+	if (Status != (s32)XST_SUCCESS) {
+		goto END;
+	}
+	InstancePtr->IsBusy = (u32)FALSE;
+
+	/* Never report a read which did not cover the whole range */
+	if (Done != ByteCount) {
+		Status = (s32)XST_FAILURE;
+		goto END;
+	}
+
+#if defined  (XCLOCKING)
+	Xil_ClockDisable(InstancePtr->Config.RefClk);
+#endif
+
+	if (Stats != NULL) {
+		Elapsed = 0U;
+		if (Cfg->TimeFn != NULL) {
+			Elapsed = Cfg->TimeFn() - StartTime;
+		}
+		Stats->Bytes = Done;
+		Stats->Commands = Commands;
+		Stats->ElapsedUs = Elapsed;
+		/* Bytes per microsecond is MB/s */
+		Stats->MBps = 0U;
+		if (Elapsed != 0U) {
+			Stats->MBps = (u32)((u64)ByteCount / Elapsed);
+		}
+	}
+	Status = (s32)XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function checks the arguments of XQspiPsu_StreamRead().
+ *
+ * @param	InstancePtr is a pointer to the XQspiPsu instance.
+ * @param	Cfg is a pointer to the read command and flash geometry.
+ * @param	Addr is the flash address of the first byte.
+ * @param	RxBfrPtr is the destination buffer.
+ * @param	ByteCount is the number of bytes to read.
+ *
+ * @return
+ *		- XST_SUCCESS if the read is supported.
+ *		- XST_INVALID_PARAM otherwise.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static s32 XQspiPsu_StreamCheck(const XQspiPsu *InstancePtr,
+		const XQspiPsu_StreamCfg *Cfg, u32 Addr, const u8 *RxBfrPtr,
+		u32 ByteCount)
+{
+	u64 FlashSize = Cfg->DevSize;
+	s32 Status = (s32)XST_INVALID_PARAM;
+
+	if ((Cfg->AddrBytes != 3U) && (Cfg->AddrBytes != 4U)) {
+		goto END;
+	}
+	if ((Cfg->BusWidth != XQSPIPSU_SELECT_MODE_SPI) &&
+			(Cfg->BusWidth != XQSPIPSU_SELECT_MODE_DUALSPI) &&
+			(Cfg->BusWidth != XQSPIPSU_SELECT_MODE_QUADSPI)) {
+		goto END;
+	}
+	/* Whole word dies keep every command after the first word aligned */
+	if ((Cfg->DieSize == 0U) || ((Cfg->DieSize % 4U) != 0U) ||
+			(Cfg->DieSize > Cfg->DevSize)) {
+		goto END;
+	}
+	if ((Cfg->AddrBytes == 3U) &&
+			(Cfg->DevSize > XQSPIPSU_STREAM_3B_ADDR_MAX)) {
+		goto END;
+	}
+	if (InstancePtr->Config.ConnectionMode !=
+			XQSPIPSU_CONNECTION_MODE_SINGLE) {
+		FlashSize *= 2U;
+	}
+	if (((Addr % 4U) != 0U) || (((UINTPTR)RxBfrPtr % 4U) != 0U) ||
+			(ByteCount == 0U) ||
+			(((u64)Addr + ByteCount) > FlashSize) ||
+			(FlashSize > ((u64)1U << 32U))) {
+		goto END;
+	}
+	Status = (s32)XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function returns the part of a streaming read from Addr onwards
+ * which is read by one command, that is up to the end of the die holding
+ * Addr and at most XQSPIPSU_DMA_BYTES_MAX bytes.
+ *
+ * @param	InstancePtr is a pointer to the XQspiPsu instance.
+ * @param	Cfg is a pointer to the read command and flash geometry.
+ * @param	Addr is the flash address of the first byte.
+ * @param	Left is the number of bytes left to read.
+ * @param	Seg is filled with the flash selection, address and length.
+ *
+ * @return	None
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static void XQspiPsu_StreamGetSeg(const XQspiPsu *InstancePtr,
+		const XQspiPsu_StreamCfg *Cfg, u32 Addr, u32 Left,
+		XQspiPsu_StreamSeg *Seg)
+{
+	u32 DieLeft;
+
+	switch (InstancePtr->Config.ConnectionMode) {
+		case XQSPIPSU_CONNECTION_MODE_STACKED:
+			Seg->FlashBus = XQSPIPSU_SELECT_FLASH_BUS_LOWER;
+			if (Addr >= Cfg->DevSize) {
+				Seg->FlashCS = XQSPIPSU_SELECT_FLASH_CS_UPPER;
+				Seg->FlashAddr = Addr - Cfg->DevSize;
+			} else {
+				Seg->FlashCS = XQSPIPSU_SELECT_FLASH_CS_LOWER;
+				Seg->FlashAddr = Addr;
+			}
+			DieLeft = Cfg->DieSize - (Seg->FlashAddr % Cfg->DieSize);
+			break;
+		case XQSPIPSU_CONNECTION_MODE_PARALLEL:
+			/* Each flash holds every other byte of the data */
+			Seg->FlashCS = XQSPIPSU_SELECT_FLASH_CS_BOTH;
+			Seg->FlashBus = XQSPIPSU_SELECT_FLASH_BUS_BOTH;
+			Seg->FlashAddr = Addr / 2U;
+			DieLeft = Cfg->DieSize - (Seg->FlashAddr % Cfg->DieSize);
+			DieLeft = (DieLeft > (XQSPIPSU_DMA_BYTES_MAX / 2U)) ?
+					XQSPIPSU_DMA_BYTES_MAX : (DieLeft * 2U);
+			break;
+		default:
+			Seg->FlashCS = XQSPIPSU_SELECT_FLASH_CS_LOWER;
+			Seg->FlashBus = XQSPIPSU_SELECT_FLASH_BUS_LOWER;
+			Seg->FlashAddr = Addr;
+			DieLeft = Cfg->DieSize - (Seg->FlashAddr % Cfg->DieSize);
+			break;
+	}
+
+	if (DieLeft > XQSPIPSU_DMA_BYTES_MAX) {
+		DieLeft = XQSPIPSU_DMA_BYTES_MAX;
+	}
+	Seg->Len = (Left < DieLeft) ? Left : DieLeft;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function writes one GENFIFO entry, waiting for room in the GENFIFO.
+ *
+ * @param	InstancePtr is a pointer to the XQspiPsu instance.
+ * @param	Entry is the GENFIFO entry.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if the GENFIFO stays full.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static s32 XQspiPsu_StreamPush(const XQspiPsu *InstancePtr, u32 Entry)
+{
+	if (Xil_WaitForEvent((InstancePtr->Config.BaseAddress + XQSPIPSU_ISR_OFFSET),
+			XQSPIPSU_ISR_GENFIFONOT_FULL_MASK,
+			XQSPIPSU_ISR_GENFIFONOT_FULL_MASK,
+			XQSPIPSU_STREAM_DELAY_CNT) != (u32)XST_SUCCESS) {
+		return (s32)XST_FAILURE;
+	}
+#ifdef DEBUG
+	xil_printf("\nFifoEntry=%08x\r\n", Entry);
+#endif
+	XQspiPsu_WriteReg(InstancePtr->Config.BaseAddress,
+			XQSPIPSU_GEN_FIFO_OFFSET, Entry);
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function queues the CS assert, opcode, address and dummy GENFIFO
+ * entries of a read command. The opcode and address bytes are sent as
+ * immediate data so that the TX FIFO and the read mode are left untouched
+ * while a DMA is running.
+ *
+ * @param	InstancePtr is a pointer to the XQspiPsu instance.
+ * @param	Cfg is a pointer to the read command and flash geometry.
+ * @param	FlashAddr is the address sent to the flash.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if the GENFIFO stays full.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static s32 XQspiPsu_StreamCmd(const XQspiPsu *InstancePtr,
+		const XQspiPsu_StreamCfg *Cfg, u32 FlashAddr)
+{
+	u32 Select = InstancePtr->GenFifoCS | InstancePtr->GenFifoBus;
+	u32 Shift = (u32)Cfg->AddrBytes * 8U;
+	s32 Status;
+
+	Status = XQspiPsu_StreamPush(InstancePtr, XQSPIPSU_GENFIFO_MODE_SPI |
+			Select | XQSPIPSU_GENFIFO_CS_SETUP);
+	if (Status != (s32)XST_SUCCESS) {
+		goto END;
+	}
+	Status = XQspiPsu_StreamPush(InstancePtr, XQSPIPSU_GENFIFO_MODE_SPI |
+			Select | XQSPIPSU_GENFIFO_TX | Cfg->Cmd);
+	while ((Status == (s32)XST_SUCCESS) && (Shift != 0U)) {
+		Shift -= 8U;
+		Status = XQspiPsu_StreamPush(InstancePtr,
+				XQSPIPSU_GENFIFO_MODE_SPI | Select |
+				XQSPIPSU_GENFIFO_TX |
+				((FlashAddr >> Shift) & XQSPIPSU_GENFIFO_IMM_DATA_MASK));
+	}
+	if ((Status == (s32)XST_SUCCESS) && (Cfg->DummyCycles != 0U)) {
+		Status = XQspiPsu_StreamPush(InstancePtr,
+				XQspiPsu_SelectSpiMode(Cfg->BusWidth) | Select |
+				XQSPIPSU_GENFIFO_DATA_XFER | Cfg->DummyCycles);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function programs the RX DMA for a data phase and queues its GENFIFO
+ * entries. The previous DMA must be done.
+ *
+ * @param	InstancePtr is a pointer to the XQspiPsu instance.
+ * @param	Cfg is a pointer to the read command and flash geometry.
+ * @param	Msg is a pointer to the data phase, ByteCount a multiple of 4.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if the GENFIFO stays full.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static s32 XQspiPsu_StreamData(XQspiPsu *InstancePtr,
+		const XQspiPsu_StreamCfg *Cfg, XQspiPsu_Msg *Msg)
+{
+	u32 Entry;
+	u32 TempCount;
+	u32 Exponent;
+	s32 Status = (s32)XST_SUCCESS;
+
+	XQspiPsu_RXSetup(InstancePtr, Msg);
+
+	Entry = XQspiPsu_SelectSpiMode((u8)Cfg->BusWidth) |
+		InstancePtr->GenFifoCS | InstancePtr->GenFifoBus |
+		XQSPIPSU_GENFIFO_DATA_XFER | XQSPIPSU_GENFIFO_RX;
+	if (InstancePtr->Config.ConnectionMode ==
+			XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		Entry |= XQSPIPSU_GENFIFO_STRIPE;
+	}
+
+	/* Same length encoding as XQspiPsu_GenFifoEntryDataLen() */
+	if (Msg->ByteCount <= XQSPIPSU_GENFIFO_IMM_DATA_MASK) {
+		Status = XQspiPsu_StreamPush(InstancePtr, Entry | Msg->ByteCount);
+		goto END;
+	}
+	TempCount = Msg->ByteCount >> 8U;
+	Exponent = 8U;
+	while ((Status == (s32)XST_SUCCESS) && (TempCount != 0U)) {
+		if ((TempCount & 1U) != 0U) {
+			Status = XQspiPsu_StreamPush(InstancePtr,
+					Entry | XQSPIPSU_GENFIFO_EXP | Exponent);
+		}
+		TempCount >>= 1U;
+		Exponent++;
+	}
+	if ((Status == (s32)XST_SUCCESS) &&
+			((Msg->ByteCount & XQSPIPSU_GENFIFO_IMM_DATA_MASK) != 0U)) {
+		Status = XQspiPsu_StreamPush(InstancePtr, Entry |
+				(Msg->ByteCount & XQSPIPSU_GENFIFO_IMM_DATA_MASK));
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function waits for the RX DMA of a data phase to be done and
+ * invalidates the data cache over the received data.
+ *
+ * @param	InstancePtr is a pointer to the XQspiPsu instance.
+ * @param	Msg is a pointer to the data phase.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if the DMA does not complete.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static s32 XQspiPsu_StreamWaitDma(const XQspiPsu *InstancePtr,
+		const XQspiPsu_Msg *Msg)
+{
+	u32 DmaIntrSts;
+
+	if (Xil_WaitForEvent((InstancePtr->Config.BaseAddress + XQSPIPSU_QSPIDMA_DST_I_STS_OFFSET),
+			XQSPIPSU_QSPIDMA_DST_I_STS_DONE_MASK,
+			XQSPIPSU_QSPIDMA_DST_I_STS_DONE_MASK,
+			XQSPIPSU_STREAM_DELAY_CNT) != (u32)XST_SUCCESS) {
+		return (s32)XST_FAILURE;
+	}
+	/* DMA Intr write to clear */
+	DmaIntrSts = XQspiPsu_ReadReg(InstancePtr->Config.BaseAddress,
+			XQSPIPSU_QSPIDMA_DST_I_STS_OFFSET);
+	XQspiPsu_WriteReg(InstancePtr->Config.BaseAddress,
+			XQSPIPSU_QSPIDMA_DST_I_STS_OFFSET, DmaIntrSts);
+	if (InstancePtr->Config.IsCacheCoherent == 0U) {
+		Xil_DCacheInvalidateRange((INTPTR)Msg->RxBfrPtr,
+				(INTPTR)Msg->ByteCount);
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function waits for the queued commands of a streaming read to be
+ * done, that is for the DMA of the last data phase and for the GENFIFO to
+ * be empty.
+ *
+ * @param	InstancePtr is a pointer to the XQspiPsu instance.
+ * @param	Pending is a pointer to the last data phase, NULL if none.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if the DMA or the GENFIFO does not complete.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static s32 XQspiPsu_StreamDrain(const XQspiPsu *InstancePtr,
+		const XQspiPsu_Msg *Pending)
+{
+	s32 Status = (s32)XST_SUCCESS;
+
+	if (Pending != NULL) {
+		Status = XQspiPsu_StreamWaitDma(InstancePtr, Pending);
+		if (Status != (s32)XST_SUCCESS) {
+			goto END;
+		}
+	}
+	if (Xil_WaitForEvent((InstancePtr->Config.BaseAddress + XQSPIPSU_ISR_OFFSET),
+			XQSPIPSU_ISR_GENFIFOEMPTY_MASK,
+			XQSPIPSU_ISR_GENFIFOEMPTY_MASK,
+			XQSPIPSU_STREAM_DELAY_CNT) != (u32)XST_SUCCESS) {
+		Status = (s32)XST_FAILURE;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function reads a command of a streaming read which is too short for
+ * the DMA or not a whole number of words, using XQspiPsu_PolledTransfer()
+ * which reads the trailing bytes in IO mode.
+ *
+ * @param	InstancePtr is a pointer to the XQspiPsu instance.
+ * @param	Cfg is a pointer to the read command and flash geometry.
+ * @param	Seg is a pointer to the segment to read.
+ * @param	RxBfrPtr is the destination of the segment.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if the transfer fails.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static s32 XQspiPsu_StreamTail(XQspiPsu *InstancePtr,
+		const XQspiPsu_StreamCfg *Cfg, const XQspiPsu_StreamSeg *Seg,
+		u8 *RxBfrPtr)
+{
+	XQspiPsu_Msg Msg[3];
+	u8 CmdBfr[5];
+	u32 Index;
+	u32 NumMsg = 0U;
+
+	CmdBfr[0] = Cfg->Cmd;
+	for (Index = 1U; Index <= Cfg->AddrBytes; Index++) {
+		CmdBfr[Index] = (u8)(Seg->FlashAddr >>
+				((Cfg->AddrBytes - Index) * 8U));
+	}
+
+	for (Index = 0U; Index < 3U; Index++) {
+		Msg[Index].TxBfrPtr = NULL;
+		Msg[Index].RxBfrPtr = NULL;
+		Msg[Index].Flags = 0U;
+		Msg[Index].RxAddr64bit = 0U;
+		Msg[Index].Xfer64bit = 0U;
+	}
+
+	Msg[NumMsg].TxBfrPtr = CmdBfr;
+	Msg[NumMsg].ByteCount = (u32)Cfg->AddrBytes + 1U;
+	Msg[NumMsg].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	Msg[NumMsg].Flags = XQSPIPSU_MSG_FLAG_TX;
+	NumMsg++;
+	if (Cfg->DummyCycles != 0U) {
+		Msg[NumMsg].ByteCount = Cfg->DummyCycles;
+		Msg[NumMsg].BusWidth = Cfg->BusWidth;
+		NumMsg++;
+	}
+	Msg[NumMsg].RxBfrPtr = RxBfrPtr;
+	Msg[NumMsg].ByteCount = Seg->Len;
+	Msg[NumMsg].BusWidth = Cfg->BusWidth;
+	Msg[NumMsg].Flags = XQSPIPSU_MSG_FLAG_RX;
+	if (InstancePtr->Config.ConnectionMode ==
+			XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		Msg[NumMsg].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
+	}
+	NumMsg++;
+
+	XQspiPsu_SelectFlash(InstancePtr, Seg->FlashCS, Seg->FlashBus);
+
+	return XQspiPsu_PolledTransfer(InstancePtr, Msg, NumMsg);
+}
+/** @} */
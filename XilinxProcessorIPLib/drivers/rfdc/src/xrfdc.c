@@ -210,6 +210,8 @@
 *       cog    01/18/22 Refactor connected data components.
 *       cog    01/18/22 Added safety checks.
 * 12.0  cog    09/01/22 Upversion.
+*       agt    10/18/26 Clear the register transaction on initialization.
+*       agt    10/18/26 Clear the PLL divider solutions on initialization.
 *
 * </pre>
 *
@@ -288,6 +290,9 @@ u32 XRFdc_CfgInitialize(XRFdc *InstancePtr, XRFdc_Config *ConfigPtr)
 	InstancePtr->RFdc_Config = *ConfigPtr;
 	InstancePtr->ADC4GSPS = ConfigPtr->ADCType;
 	InstancePtr->StatusHandler = StubHandler;
+	InstancePtr->Txn = NULL;
+	InstancePtr->PLLSolver[XRFDC_ADC_TILE] = NULL;
+	InstancePtr->PLLSolver[XRFDC_DAC_TILE] = NULL;
 
 	/*
 	 * Indicate the instance is now ready to use.
@@ -289,6 +289,11 @@
 *                       DAC coupling.
 *       cog    01/07/23 Added VOP support for DC coupled DACs and removed VOP
 *                       support for ES1 Parts.
+*       agt    10/18/26 Added register transactions, XRFdc_TxnBegin() and
+*                       XRFdc_TxnCommit().
+*       agt    10/18/26 Added PLL divider solution tables, XRFdc_PLLSolverInit(),
+*                       fixed point NCO frequency words, XRFdc_GetNCOFreqWord(),
+*                       and batched mixer retuning, XRFdc_RetuneMixers().
 *
 * </pre>
 *
@@ -759,6 +764,56 @@ typedef struct {
 	XRFdc_ADCBlock_DigitalDataPath ADCBlock_Digital_Datapath[4];
 } XRFdc_ADC_Tile;
 
+/**
+ * Register Transaction Entry Structure.
+ */
+typedef struct {
+	u32 Addr; /* Register offset in the IP */
+	u16 Value; /* Value to be written */
+	u8 Event; /* Set for the update dynamic event registers */
+} XRFdc_TxnEntry;
+
+/**
+ * Register Transaction Structure.
+ */
+typedef struct {
+	XRFdc_TxnEntry *Entries; /* Pending writes, allocated by the caller */
+	u32 MaxEntries; /* Number of entries of Entries */
+	u32 NumEntries; /* Number of pending writes */
+	u32 Accesses; /* 16-bit register accesses made by the driver */
+	u32 Reads; /* Register reads issued on the bus */
+	u32 Writes; /* Register writes issued on the bus */
+} XRFdc_Txn;
+
+/**
+ * PLL Divider Solution Structure.
+ */
+typedef struct {
+	double SampleRate; /* Sampling rate obtained in MHz */
+	u16 Rank; /* Position of the dividers in the divider sweep */
+	u8 FeedbackDivider; /* Feedback divider (N) */
+	u8 OutputDivider; /* Output divider (M) */
+} XRFdc_PLL_Solution;
+
+/**
+ * PLL Divider Solver Structure.
+ */
+typedef struct {
+	XRFdc_PLL_Solution *Solutions; /* Solutions sorted by rate, allocated by the caller */
+	u32 NumSolutions; /* Number of solutions */
+	double RefClkFreq; /* PLL input reference clock frequency in MHz */
+} XRFdc_PLL_Solver;
+
+/**
+ * Mixer Retune Structure.
+ */
+typedef struct {
+	u32 Type; /* ADC or DAC */
+	u32 Tile_Id; /* Tile number (0-3) */
+	u32 Block_Id; /* Block number (0-3) */
+	XRFdc_Mixer_Settings *MixerSettingsPtr; /* Mixer settings to apply */
+} XRFdc_Mixer_Retune;
+
 /**
  * RFdc Structure.
  */
@@ -774,6 +829,8 @@ typedef struct {
 	XRFdc_StatusHandler StatusHandler; /* Event handler function */
 	void *CallBackRef; /* Callback reference for event handler */
 	u8 UpdateMixerScale; /* Set to 1, if user overwrite mixer scale */
+	XRFdc_Txn *Txn; /* Active register transaction, NULL if none */
+	XRFdc_PLL_Solver *PLLSolver[2]; /* PLL divider solutions per ADC/DAC, NULL if none */
 } XRFdc;
 #ifndef __BAREMETAL__
 #pragma pack()
@@ -982,6 +1039,8 @@ typedef struct {
 #define VCO_RANGE_ADC_MAX 12800U
 #define VCO_RANGE_DAC_MIN 7800U
 #define VCO_RANGE_DAC_MAX 13800U
+#define PLL_OUTDIV_NUM 16U
+#define PLL_SOLUTIONS_MAX ((PLL_FPDIV_MAX - PLL_FPDIV_MIN + 1U) * PLL_OUTDIV_NUM)
 #define XRFDC_PLL_LPF1_VAL 0x6U
 #define XRFDC_PLL_CRS2_VAL 0x7008U
 #define XRFDC_VCO_UPPER_BAND 0x0U
@@ -1482,6 +1541,17 @@ u32 XRFdc_GetMTSEnable(XRFdc *InstancePtr, u32 Type, u32 Tile, u32 *EnablePtr);
 u32 XRFdc_SetDACDataScaler(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id, u32 Enable);
 u32 XRFdc_GetDACDataScaler(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id, u32 *EnablePtr);
 u8 XRFdc_GetTileLayout(XRFdc *InstancePtr);
+u32 XRFdc_TxnBegin(XRFdc *InstancePtr, XRFdc_Txn *TxnPtr, XRFdc_TxnEntry *EntriesPtr, u32 NumEntries);
+u32 XRFdc_TxnCommit(XRFdc *InstancePtr);
+u16 XRFdc_TxnRead16(XRFdc *InstancePtr, u32 Addr);
+void XRFdc_TxnWrite16(XRFdc *InstancePtr, u32 Addr, u16 Data);
+u32 XRFdc_PLLSolverInit(XRFdc *InstancePtr, u32 Type, XRFdc_PLL_Solver *SolverPtr, XRFdc_PLL_Solution *SolutionsPtr,
+			u32 NumSolutions, double RefClkFreq, u32 RefClkDiv);
+u32 XRFdc_PLLSolverLookup(XRFdc_PLL_Solver *SolverPtr, double RefClkFreq, double SamplingRate, u32 *FeedbackDivPtr,
+			  u32 *OutputDivPtr);
+s64 XRFdc_GetNCOFreqWord(double NCOFreq, double SamplingRate);
+u32 XRFdc_RetuneMixers(XRFdc *InstancePtr, XRFdc_Mixer_Retune *RetunePtr, u32 NumBlocks, XRFdc_TxnEntry *EntriesPtr,
+		       u32 NumEntries);
 #ifndef __BAREMETAL__
 s32 XRFdc_GetDeviceNameByDeviceId(char *DevNamePtr, u16 DevId);
 #endif
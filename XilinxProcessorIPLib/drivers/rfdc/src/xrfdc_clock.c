@@ -81,6 +81,8 @@
 *                       clock combinations.
 *       cog    01/12/22 Fix compiler warnings.
 *       cog    01/24/22 Fix static analysis errors.
+* 12.0  agt    10/18/26 PLL registers are written once, after the divider sweep.
+*       agt    10/18/26 Added precomputed PLL divider solutions.
 * </pre>
 *
 ******************************************************************************/
@@ -109,6 +111,11 @@ static u32 PllTuningMatrix[8][4][2] = {
 /***************** Macros (Inline Functions) Definitions *********************/
 static u32 XRFdc_CheckClkDistValid(XRFdc *InstancePtr, XRFdc_Distribution_Settings *DistributionSettingsPtr);
 static u32 XRFdc_SetPLLConfig(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, double RefClkFreq, double SamplingRate);
+static void XRFdc_GetPLLVCORange(XRFdc *InstancePtr, u32 Type, u32 *VCOMinPtr, u32 *VCOMaxPtr);
+static u32 XRFdc_GetPLLOutputDiv(u32 Order);
+static double XRFdc_GetPLLRateError(double SamplingRate, double CalcSamplingRate);
+static void XRFdc_SweepPLLDividers(XRFdc *InstancePtr, double RefClkFreq, double SamplingRate, u32 VCOMin, u32 VCOMax,
+				   u32 *FeedbackDivPtr, u32 *OutputDivPtr);
 static void XRFdc_DistTile2TypeTile(XRFdc *InstancePtr, u32 DistTile, u32 *Type, u32 *Tile_Id);
 static u8 XRFdc_TypeTile2DistTile(XRFdc *InstancePtr, u32 Type, u32 Tile_Id);
 
@@ -1162,6 +1169,161 @@ RETURN_PATH:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* Gets the VCO range of the internal PLL of a tile type.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type indicates ADC/DAC.
+* @param    VCOMinPtr pointer to return the minimum VCO frequency in MHz.
+* @param    VCOMaxPtr pointer to return the maximum VCO frequency in MHz.
+*
+* @return
+*           - None
+*
+* @note     Static API used only in this file.
+*
+******************************************************************************/
+static void XRFdc_GetPLLVCORange(XRFdc *InstancePtr, u32 Type, u32 *VCOMinPtr, u32 *VCOMaxPtr)
+{
+	if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
+		*VCOMinPtr = VCO_RANGE_MIN;
+		*VCOMaxPtr = VCO_RANGE_MAX;
+	} else {
+		if (Type == XRFDC_ADC_TILE) {
+			*VCOMinPtr = VCO_RANGE_ADC_MIN;
+			*VCOMaxPtr = VCO_RANGE_ADC_MAX;
+		} else {
+			*VCOMinPtr = VCO_RANGE_DAC_MIN;
+			*VCOMaxPtr = VCO_RANGE_DAC_MAX;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Gets the output divider at a position of the output divider sweep. For
+* each feedback divider, the sweep tries 1 (Gen 3 only), the even dividers
+* from 2 to 28, then 3.
+*
+* @param    Order is the position in the output divider sweep.
+*
+* @return
+*           - Output divider.
+*
+* @note     Static API used only in this file.
+*
+******************************************************************************/
+static u32 XRFdc_GetPLLOutputDiv(u32 Order)
+{
+	u32 OutputDiv;
+
+	if (Order == 0U) {
+		OutputDiv = PLL_DIVIDER_MIN_GEN3;
+	} else if (Order == (PLL_OUTDIV_NUM - 1U)) {
+		OutputDiv = 3U;
+	} else {
+		OutputDiv = Order * 2U;
+	}
+
+	return OutputDiv;
+}
+
+/*****************************************************************************/
+/**
+*
+* Gets the error between a requested and an obtained sampling rate.
+*
+* @param    SamplingRate is the requested sampling rate in MHz.
+* @param    CalcSamplingRate is the obtained sampling rate in MHz.
+*
+* @return
+*           - Absolute error in MHz.
+*
+* @note     Static API used only in this file.
+*
+******************************************************************************/
+static double XRFdc_GetPLLRateError(double SamplingRate, double CalcSamplingRate)
+{
+	double SamplingError;
+
+	if (SamplingRate > CalcSamplingRate) {
+		SamplingError = SamplingRate - CalcSamplingRate;
+	} else {
+		SamplingError = CalcSamplingRate - SamplingRate;
+	}
+
+	return SamplingError;
+}
+
+/*****************************************************************************/
+/**
+*
+* Sweeps the valid feedback and output dividers for the ones that best match
+* the requested sampling rate.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    RefClkFreq is the PLL input reference clock frequency in MHz.
+* @param    SamplingRate is the requested sampling rate in MHz.
+* @param    VCOMin is the minimum VCO frequency in MHz.
+* @param    VCOMax is the maximum VCO frequency in MHz.
+* @param    FeedbackDivPtr pointer to return the feedback divider.
+* @param    OutputDivPtr pointer to return the output divider.
+*
+* @return
+*           - None
+*
+* @note     Of the dividers giving the same error, the first swept is used.
+*
+******************************************************************************/
+static void XRFdc_SweepPLLDividers(XRFdc *InstancePtr, double RefClkFreq, double SamplingRate, u32 VCOMin, u32 VCOMax,
+				   u32 *FeedbackDivPtr, u32 *OutputDivPtr)
+{
+	u32 FeedbackDiv;
+	u32 OutputDiv;
+	u32 Order;
+	double PllFreq;
+	double SamplingError;
+	u32 Best_FeedbackDiv = 0x0U;
+	u32 Best_OutputDiv = 0x2U;
+	double Best_Error = 0xFFFFFFFFU;
+
+	/*
+	 * Sweep valid integer values of FeedbackDiv(N) and record a list
+	 * of values that fall in the valid VCO range 8.5GHz - 12.8GHz
+	 */
+	for (FeedbackDiv = PLL_FPDIV_MIN; FeedbackDiv <= PLL_FPDIV_MAX; FeedbackDiv++) {
+		PllFreq = FeedbackDiv * RefClkFreq;
+
+		if ((PllFreq < VCOMin) || (PllFreq > VCOMax)) {
+			continue;
+		}
+
+		/*
+		 * Sweep values of OutputDiv(M) to find the output frequency
+		 * that best matches the user requested value
+		 */
+		for (Order = 0U; Order < PLL_OUTDIV_NUM; Order++) {
+			if ((Order == 0U) && (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3)) {
+				continue;
+			}
+			OutputDiv = XRFdc_GetPLLOutputDiv(Order);
+			SamplingError = XRFdc_GetPLLRateError(SamplingRate, (PllFreq / OutputDiv));
+
+			if (Best_Error > SamplingError) {
+				Best_FeedbackDiv = FeedbackDiv;
+				Best_OutputDiv = OutputDiv;
+				Best_Error = SamplingError;
+			}
+		}
+	}
+
+	*FeedbackDivPtr = Best_FeedbackDiv;
+	*OutputDivPtr = Best_OutputDiv;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1185,14 +1347,10 @@ static u32 XRFdc_SetPLLConfig(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, double
 {
 	u32 BaseAddr;
 	u32 Status;
-	u32 FeedbackDiv;
-	u32 OutputDiv;
 	double CalcSamplingRate;
 	double PllFreq;
-	double SamplingError;
 	u32 Best_FeedbackDiv = 0x0U;
 	u32 Best_OutputDiv = 0x2U;
-	double Best_Error = 0xFFFFFFFFU;
 	u32 DivideMode = 0x0U;
 	u32 DivideValue = 0x0U;
 	u32 PllFreqIndex = 0x0U;
@@ -1201,6 +1359,7 @@ static u32 XRFdc_SetPLLConfig(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, double
 	u16 ReadReg;
 	u32 VCOMin;
 	u32 VCOMax;
+	XRFdc_PLL_Solver *SolverPtr;
 
 	if (Type == XRFDC_ADC_TILE) {
 		BaseAddr = XRFDC_ADC_TILE_DRP_ADDR(Tile_Id);
@@ -1240,260 +1399,195 @@ static u32 XRFdc_SetPLLConfig(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, double
 	RefClkFreq /= RefClkDiv;
 
 	/*
-	 * Sweep valid integer values of FeedbackDiv(N) and record a list
-	 * of values that fall in the valid VCO range 8.5GHz - 12.8GHz
+	 * Use the precomputed divider solutions if they were made for this
+	 * reference clock, otherwise sweep the dividers.
 	 */
+	SolverPtr = InstancePtr->PLLSolver[Type];
+	if ((SolverPtr == NULL) || (XRFdc_PLLSolverLookup(SolverPtr, RefClkFreq, SamplingRate, &Best_FeedbackDiv,
+							  &Best_OutputDiv) != XRFDC_SUCCESS)) {
+		XRFdc_GetPLLVCORange(InstancePtr, Type, &VCOMin, &VCOMax);
+		XRFdc_SweepPLLDividers(InstancePtr, RefClkFreq, SamplingRate, VCOMin, VCOMax, &Best_FeedbackDiv,
+				       &Best_OutputDiv);
+	}
 
+	/*
+	 * PLL Static configuration
+	 */
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SDM_CFG0, 0x80U);
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SDM_SEED0, 0x111U);
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SDM_SEED1, 0x11U);
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VCO1, 0x08U);
 	if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
-		VCOMin = VCO_RANGE_MIN;
-		VCOMax = VCO_RANGE_MAX;
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VREG, 0x45U);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VCO0, 0x5800U);
+
 	} else {
-		if (Type == XRFDC_ADC_TILE) {
-			VCOMin = VCO_RANGE_ADC_MIN;
-			VCOMax = VCO_RANGE_ADC_MAX;
-		} else {
-			VCOMin = VCO_RANGE_DAC_MIN;
-			VCOMax = VCO_RANGE_DAC_MAX;
-		}
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VREG, 0x2DU);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VCO0, 0x5F03U);
 	}
+	/*
+	 * Set Feedback divisor value
+	 */
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_FPDIV, Best_FeedbackDiv - 2U);
 
-	for (FeedbackDiv = PLL_FPDIV_MIN; FeedbackDiv <= PLL_FPDIV_MAX; FeedbackDiv++) {
-		PllFreq = FeedbackDiv * RefClkFreq;
-
-		if ((PllFreq >= VCOMin) && (PllFreq <= VCOMax)) {
-			/*
-			 * Sweep values of OutputDiv(M) to find the output frequency
-			 * that best matches the user requested value
-			 */
-			if (InstancePtr->RFdc_Config.IPType >= XRFDC_GEN3) {
-				OutputDiv = PLL_DIVIDER_MIN_GEN3;
-				CalcSamplingRate = (PllFreq / OutputDiv);
-
-				if (SamplingRate > CalcSamplingRate) {
-					SamplingError = SamplingRate - CalcSamplingRate;
-				} else {
-					SamplingError = CalcSamplingRate - SamplingRate;
-				}
-
-				if (Best_Error > SamplingError) {
-					Best_FeedbackDiv = FeedbackDiv;
-					Best_OutputDiv = OutputDiv;
-					Best_Error = SamplingError;
-				}
-			}
-			for (OutputDiv = PLL_DIVIDER_MIN; OutputDiv <= PLL_DIVIDER_MAX; OutputDiv += 2U) {
-				CalcSamplingRate = (PllFreq / OutputDiv);
-
-				if (SamplingRate > CalcSamplingRate) {
-					SamplingError = SamplingRate - CalcSamplingRate;
-				} else {
-					SamplingError = CalcSamplingRate - SamplingRate;
-				}
-
-				if (Best_Error > SamplingError) {
-					Best_FeedbackDiv = FeedbackDiv;
-					Best_OutputDiv = OutputDiv;
-					Best_Error = SamplingError;
-				}
-			}
-
-			OutputDiv = 3U;
-			CalcSamplingRate = (PllFreq / OutputDiv);
-
-			if (SamplingRate > CalcSamplingRate) {
-				SamplingError = SamplingRate - CalcSamplingRate;
-			} else {
-				SamplingError = CalcSamplingRate - SamplingRate;
-			}
-
-			if (Best_Error > SamplingError) {
-				Best_FeedbackDiv = FeedbackDiv;
-				Best_OutputDiv = OutputDiv;
-				Best_Error = SamplingError;
-			}
-		}
+	/*
+	 * Set Output divisor value
+	 */
+	if (Best_OutputDiv == 1U) {
+		DivideMode = 0x0U;
+		/*if divisor is 1 bypass toatally*/
+		DivideValue = XRFDC_PLL_DIVIDER0_BYP_OPDIV_MASK;
+	} else if (Best_OutputDiv == 2U) {
+		DivideMode = 0x1U;
+	} else if (Best_OutputDiv == 3U) {
+		DivideMode = 0x2U;
+		DivideValue = 0x1U;
+	} else if (Best_OutputDiv >= 4U) {
+		DivideMode = 0x3U;
+		DivideValue = ((Best_OutputDiv - 4U) / 2U);
+	}
 
-		/*
-		 * PLL Static configuration
-		 */
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SDM_CFG0, 0x80U);
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SDM_SEED0, 0x111U);
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SDM_SEED1, 0x11U);
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VCO1, 0x08U);
-		if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VREG, 0x45U);
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VCO0, 0x5800U);
+	XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_PLL_DIVIDER0, XRFDC_PLL_DIVIDER0_MASK,
+			((DivideMode << XRFDC_PLL_DIVIDER0_SHIFT) | DivideValue));
 
+	if (InstancePtr->RFdc_Config.IPType >= XRFDC_GEN3) {
+		if (Best_OutputDiv > PLL_DIVIDER_MIN_GEN3) {
+			XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_PLL_DIVIDER0, XRFDC_PLL_DIVIDER0_ALT_MASK,
+					XRFDC_DISABLED);
 		} else {
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VREG, 0x2DU);
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VCO0, 0x5F03U);
+			XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_PLL_DIVIDER0, XRFDC_PLL_DIVIDER0_ALT_MASK,
+					XRFDC_PLL_DIVIDER0_BYPDIV_MASK);
 		}
-		/*
-		 * Set Feedback divisor value
-		 */
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_FPDIV, Best_FeedbackDiv - 2U);
+	}
+	/*
+	 * Enable fine sweep
+	 */
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_CRS2, XRFDC_PLL_CRS2_VAL);
 
-		/*
-		 * Set Output divisor value
-		 */
-		if (Best_OutputDiv == 1U) {
-			DivideMode = 0x0U;
-			/*if divisor is 1 bypass toatally*/
-			DivideValue = XRFDC_PLL_DIVIDER0_BYP_OPDIV_MASK;
-		} else if (Best_OutputDiv == 2U) {
-			DivideMode = 0x1U;
-		} else if (Best_OutputDiv == 3U) {
-			DivideMode = 0x2U;
-			DivideValue = 0x1U;
-		} else if (Best_OutputDiv >= 4U) {
-			DivideMode = 0x3U;
-			DivideValue = ((Best_OutputDiv - 4U) / 2U);
+	/*
+	 * Set default PLL spare inputs LSB
+	 */
+	if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE0, 0x507U);
+	} else {
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE0, 0x0D37U);
+	}
+	/*
+	 * Set PLL spare inputs MSB
+	 */
+	if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE1, 0x0U);
+	} else {
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE1, 0x80U);
+	}
+	PllFreq = RefClkFreq * Best_FeedbackDiv;
+
+	if (PllFreq < 9400U) {
+		PllFreqIndex = 0U;
+		FbDivIndex = 2U;
+		if (Best_FeedbackDiv < 21U) {
+			FbDivIndex = 0U;
+		} else if (Best_FeedbackDiv < 30U) {
+			FbDivIndex = 1U;
 		}
-
-		XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_PLL_DIVIDER0, XRFDC_PLL_DIVIDER0_MASK,
-				((DivideMode << XRFDC_PLL_DIVIDER0_SHIFT) | DivideValue));
-
-		if (InstancePtr->RFdc_Config.IPType >= XRFDC_GEN3) {
-			if (Best_OutputDiv > PLL_DIVIDER_MIN_GEN3) {
-				XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_PLL_DIVIDER0, XRFDC_PLL_DIVIDER0_ALT_MASK,
-						XRFDC_DISABLED);
-			} else {
-				XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_PLL_DIVIDER0, XRFDC_PLL_DIVIDER0_ALT_MASK,
-						XRFDC_PLL_DIVIDER0_BYPDIV_MASK);
-			}
+	} else if (PllFreq < 10070U) {
+		PllFreqIndex = 1U;
+		FbDivIndex = 2U;
+		if (Best_FeedbackDiv < 18U) {
+			FbDivIndex = 0U;
+		} else if (Best_FeedbackDiv < 30U) {
+			FbDivIndex = 1U;
 		}
-		/*
-		 * Enable fine sweep
-		 */
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_CRS2, XRFDC_PLL_CRS2_VAL);
-
-		/*
-		 * Set default PLL spare inputs LSB
-		 */
-		if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE0, 0x507U);
-		} else {
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE0, 0x0D37U);
+	} else if (PllFreq < 10690U) {
+		PllFreqIndex = 2U;
+		FbDivIndex = 3U;
+		if (Best_FeedbackDiv < 18U) {
+			FbDivIndex = 0U;
+		} else if (Best_FeedbackDiv < 25U) {
+			FbDivIndex = 1U;
+		} else if (Best_FeedbackDiv < 35U) {
+			FbDivIndex = 2U;
 		}
-		/*
-		 * Set PLL spare inputs MSB
-		 */
-		if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE1, 0x0U);
-		} else {
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE1, 0x80U);
+	} else if (PllFreq < 10990U) {
+		PllFreqIndex = 3U;
+		FbDivIndex = 3U;
+		if (Best_FeedbackDiv < 19U) {
+			FbDivIndex = 0U;
+		} else if (Best_FeedbackDiv < 27U) {
+			FbDivIndex = 1U;
+		} else if (Best_FeedbackDiv < 38U) {
+			FbDivIndex = 2U;
 		}
-		PllFreq = RefClkFreq * Best_FeedbackDiv;
-
-		if (PllFreq < 9400U) {
-			PllFreqIndex = 0U;
+	} else if (PllFreq < 11430U) {
+		PllFreqIndex = 4U;
+		FbDivIndex = 3U;
+		if (Best_FeedbackDiv < 19U) {
+			FbDivIndex = 0U;
+		} else if (Best_FeedbackDiv < 27U) {
+			FbDivIndex = 1U;
+		} else if (Best_FeedbackDiv < 38U) {
 			FbDivIndex = 2U;
-			if (Best_FeedbackDiv < 21U) {
-				FbDivIndex = 0U;
-			} else if (Best_FeedbackDiv < 30U) {
-				FbDivIndex = 1U;
-			}
-		} else if (PllFreq < 10070U) {
-			PllFreqIndex = 1U;
+		}
+	} else if (PllFreq < 12040U) {
+		PllFreqIndex = 5U;
+		FbDivIndex = 3U;
+		if (Best_FeedbackDiv < 20U) {
+			FbDivIndex = 0U;
+		} else if (Best_FeedbackDiv < 28U) {
+			FbDivIndex = 1U;
+		} else if (Best_FeedbackDiv < 40U) {
 			FbDivIndex = 2U;
-			if (Best_FeedbackDiv < 18U) {
-				FbDivIndex = 0U;
-			} else if (Best_FeedbackDiv < 30U) {
-				FbDivIndex = 1U;
-			}
-		} else if (PllFreq < 10690U) {
-			PllFreqIndex = 2U;
-			FbDivIndex = 3U;
-			if (Best_FeedbackDiv < 18U) {
-				FbDivIndex = 0U;
-			} else if (Best_FeedbackDiv < 25U) {
-				FbDivIndex = 1U;
-			} else if (Best_FeedbackDiv < 35U) {
-				FbDivIndex = 2U;
-			}
-		} else if (PllFreq < 10990U) {
-			PllFreqIndex = 3U;
-			FbDivIndex = 3U;
-			if (Best_FeedbackDiv < 19U) {
-				FbDivIndex = 0U;
-			} else if (Best_FeedbackDiv < 27U) {
-				FbDivIndex = 1U;
-			} else if (Best_FeedbackDiv < 38U) {
-				FbDivIndex = 2U;
-			}
-		} else if (PllFreq < 11430U) {
-			PllFreqIndex = 4U;
-			FbDivIndex = 3U;
-			if (Best_FeedbackDiv < 19U) {
-				FbDivIndex = 0U;
-			} else if (Best_FeedbackDiv < 27U) {
-				FbDivIndex = 1U;
-			} else if (Best_FeedbackDiv < 38U) {
-				FbDivIndex = 2U;
-			}
-		} else if (PllFreq < 12040U) {
-			PllFreqIndex = 5U;
-			FbDivIndex = 3U;
-			if (Best_FeedbackDiv < 20U) {
-				FbDivIndex = 0U;
-			} else if (Best_FeedbackDiv < 28U) {
-				FbDivIndex = 1U;
-			} else if (Best_FeedbackDiv < 40U) {
-				FbDivIndex = 2U;
-			}
-		} else if (PllFreq < 12530U) {
-			PllFreqIndex = 6U;
-			FbDivIndex = 3U;
-			if (Best_FeedbackDiv < 23U) {
-				FbDivIndex = 0U;
-			} else if (Best_FeedbackDiv < 30U) {
-				FbDivIndex = 1U;
-			} else if (Best_FeedbackDiv < 42U) {
-				FbDivIndex = 2U;
-			}
-		} else if (PllFreq < 20000U) {
-			PllFreqIndex = 7U;
+		}
+	} else if (PllFreq < 12530U) {
+		PllFreqIndex = 6U;
+		FbDivIndex = 3U;
+		if (Best_FeedbackDiv < 23U) {
+			FbDivIndex = 0U;
+		} else if (Best_FeedbackDiv < 30U) {
+			FbDivIndex = 1U;
+		} else if (Best_FeedbackDiv < 42U) {
 			FbDivIndex = 2U;
-			if (Best_FeedbackDiv < 20U) {
-				FbDivIndex = 0U;
-				/*
-				 * Set PLL spare inputs LSB
-				 */
-				if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
-					XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE0, 0x577);
-				} else {
-					XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE0, 0x0D37U);
-				}
-			} else if (Best_FeedbackDiv < 39U) {
-				FbDivIndex = 1U;
+		}
+	} else if (PllFreq < 20000U) {
+		PllFreqIndex = 7U;
+		FbDivIndex = 2U;
+		if (Best_FeedbackDiv < 20U) {
+			FbDivIndex = 0U;
+			/*
+			 * Set PLL spare inputs LSB
+			 */
+			if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
+				XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE0, 0x577);
+			} else {
+				XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE0, 0x0D37U);
 			}
+		} else if (Best_FeedbackDiv < 39U) {
+			FbDivIndex = 1U;
 		}
+	}
 
-		/*
-		 * Enable automatic selection of the VCO, this will work with the
-		 * IP version 2.0.1 and above and using older version of IP is
-		 * not likely to work.
-		 */
+	/*
+	 * Enable automatic selection of the VCO, this will work with the
+	 * IP version 2.0.1 and above and using older version of IP is
+	 * not likely to work.
+	 */
 
-		XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_PLL_CRS1, XRFDC_PLL_VCO_SEL_AUTO_MASK,
-				XRFDC_PLL_VCO_SEL_AUTO_MASK);
+	XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_PLL_CRS1, XRFDC_PLL_VCO_SEL_AUTO_MASK, XRFDC_PLL_VCO_SEL_AUTO_MASK);
 
-		/*
-		 * PLL bits for loop filters LSB
-		 */
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_LPF0, PllTuningMatrix[PllFreqIndex][FbDivIndex][0]);
+	/*
+	 * PLL bits for loop filters LSB
+	 */
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_LPF0, PllTuningMatrix[PllFreqIndex][FbDivIndex][0]);
 
-		/*
-		 * PLL bits for loop filters MSB
-		 */
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_LPF1, XRFDC_PLL_LPF1_VAL);
+	/*
+	 * PLL bits for loop filters MSB
+	 */
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_LPF1, XRFDC_PLL_LPF1_VAL);
 
-		/*
-		 * Set PLL bits for charge pumps
-		 */
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_CHARGEPUMP,
-				 PllTuningMatrix[PllFreqIndex][FbDivIndex][1]);
-	}
+	/*
+	 * Set PLL bits for charge pumps
+	 */
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_CHARGEPUMP, PllTuningMatrix[PllFreqIndex][FbDivIndex][1]);
 
 	CalcSamplingRate = (Best_FeedbackDiv * RefClkFreq) / Best_OutputDiv;
 	/* Store Sampling Frequency in kHz */
@@ -1519,6 +1613,213 @@ static u32 XRFdc_SetPLLConfig(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, double
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API precomputes the internal PLL divider solutions for a reference
+* clock. The solutions are then used by XRFdc_DynamicPLLConfig() for the
+* tiles of the given type that use this reference clock, instead of sweeping
+* the dividers on each call.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type indicates ADC/DAC.
+* @param    SolverPtr pointer to the solver.
+* @param    SolutionsPtr pointer to the table of solutions.
+* @param    NumSolutions is the number of entries of the table,
+*           PLL_SOLUTIONS_MAX is always enough.
+* @param    RefClkFreq Reference Clock Frequency MHz(50MHz - 1.2GHz)
+* @param    RefClkDiv is the reference clock divider of the tiles (1-4).
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if the table is too small.
+*
+* @note     Each solution is the first divider pair of the sweep giving its
+*           sampling rate, and the solutions are sorted by sampling rate, so
+*           a lookup gives the dividers the sweep would choose.
+*
+******************************************************************************/
+u32 XRFdc_PLLSolverInit(XRFdc *InstancePtr, u32 Type, XRFdc_PLL_Solver *SolverPtr, XRFdc_PLL_Solution *SolutionsPtr,
+			u32 NumSolutions, double RefClkFreq, u32 RefClkDiv)
+{
+	u32 Status;
+	u32 FeedbackDiv;
+	u32 OutputDiv;
+	u32 Order;
+	u32 Index;
+	u32 VCOMin;
+	u32 VCOMax;
+	double PllFreq;
+	double CalcSamplingRate;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(SolverPtr != NULL);
+	Xil_AssertNonvoid(SolutionsPtr != NULL);
+
+	if ((Type != XRFDC_ADC_TILE) && (Type != XRFDC_DAC_TILE)) {
+		metal_log(METAL_LOG_ERROR, "\n Invalid converter type (%u) in %s\r\n", Type, __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	if ((RefClkDiv < XRFDC_REF_CLK_DIV_1) || (RefClkDiv > XRFDC_REF_CLK_DIV_4)) {
+		metal_log(METAL_LOG_ERROR, "\n Invalid reference clock divider (%u) in %s\r\n", RefClkDiv, __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	InstancePtr->PLLSolver[Type] = NULL;
+	XRFdc_GetPLLVCORange(InstancePtr, Type, &VCOMin, &VCOMax);
+
+	SolverPtr->Solutions = SolutionsPtr;
+	SolverPtr->NumSolutions = 0U;
+	SolverPtr->RefClkFreq = RefClkFreq;
+	SolverPtr->RefClkFreq /= RefClkDiv;
+
+	for (FeedbackDiv = PLL_FPDIV_MIN; FeedbackDiv <= PLL_FPDIV_MAX; FeedbackDiv++) {
+		PllFreq = FeedbackDiv * SolverPtr->RefClkFreq;
+
+		if ((PllFreq < VCOMin) || (PllFreq > VCOMax)) {
+			continue;
+		}
+
+		for (Order = 0U; Order < PLL_OUTDIV_NUM; Order++) {
+			if ((Order == 0U) && (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3)) {
+				continue;
+			}
+			OutputDiv = XRFdc_GetPLLOutputDiv(Order);
+			CalcSamplingRate = PllFreq / OutputDiv;
+
+			/* Insert sorted, keeping the first dividers giving a rate */
+			Index = SolverPtr->NumSolutions;
+			while ((Index > 0U) && (SolutionsPtr[Index - 1U].SampleRate > CalcSamplingRate)) {
+				Index--;
+			}
+			if ((Index > 0U) && (SolutionsPtr[Index - 1U].SampleRate == CalcSamplingRate)) {
+				continue;
+			}
+			if (SolverPtr->NumSolutions == NumSolutions) {
+				metal_log(METAL_LOG_ERROR, "\n Table of %u PLL solutions too small in %s\r\n",
+					  NumSolutions, __func__);
+				Status = XRFDC_FAILURE;
+				goto RETURN_PATH;
+			}
+			memmove(&SolutionsPtr[Index + 1U], &SolutionsPtr[Index],
+				(SolverPtr->NumSolutions - Index) * sizeof(XRFdc_PLL_Solution));
+			SolutionsPtr[Index].SampleRate = CalcSamplingRate;
+			SolutionsPtr[Index].Rank = (u16)(((FeedbackDiv - PLL_FPDIV_MIN) * PLL_OUTDIV_NUM) + Order);
+			SolutionsPtr[Index].FeedbackDivider = (u8)FeedbackDiv;
+			SolutionsPtr[Index].OutputDivider = (u8)OutputDiv;
+			SolverPtr->NumSolutions++;
+		}
+	}
+
+	InstancePtr->PLLSolver[Type] = SolverPtr;
+	metal_log(METAL_LOG_DEBUG, "\n %u PLL solutions for %s reference clock %lf MHz in %s\r\n",
+		  SolverPtr->NumSolutions, (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", SolverPtr->RefClkFreq, __func__);
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API looks up the internal PLL dividers that best match a sampling rate
+* in the precomputed solutions.
+*
+* @param    SolverPtr pointer to the solver.
+* @param    RefClkFreq is the PLL input reference clock frequency in MHz,
+*           i.e. divided by the reference clock divider.
+* @param    SamplingRate is the requested sampling rate in MHz.
+* @param    FeedbackDivPtr pointer to return the feedback divider.
+* @param    OutputDivPtr pointer to return the output divider.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if the solutions are not for this reference
+*             clock.
+*
+* @note     Of the solutions giving the same error, the first swept is used,
+*           as XRFdc_DynamicPLLConfig() does when sweeping the dividers.
+*
+******************************************************************************/
+u32 XRFdc_PLLSolverLookup(XRFdc_PLL_Solver *SolverPtr, double RefClkFreq, double SamplingRate, u32 *FeedbackDivPtr,
+			  u32 *OutputDivPtr)
+{
+	u32 Status;
+	u32 Low;
+	u32 High;
+	u32 Mid;
+	u32 Index;
+	u32 Best;
+	double Error;
+	double Best_Error;
+	XRFdc_PLL_Solution *SolutionsPtr;
+
+	Xil_AssertNonvoid(SolverPtr != NULL);
+	Xil_AssertNonvoid(FeedbackDivPtr != NULL);
+	Xil_AssertNonvoid(OutputDivPtr != NULL);
+
+	if ((SolverPtr->NumSolutions == 0U) || (SolverPtr->RefClkFreq != RefClkFreq)) {
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+	SolutionsPtr = SolverPtr->Solutions;
+
+	/* First solution at or above the requested rate */
+	Low = 0U;
+	High = SolverPtr->NumSolutions;
+	while (Low < High) {
+		Mid = (Low + High) / 2U;
+		if (SolutionsPtr[Mid].SampleRate < SamplingRate) {
+			Low = Mid + 1U;
+		} else {
+			High = Mid;
+		}
+	}
+
+	/*
+	 * The nearest solutions are either side of the requested rate.
+	 * Neighbours with a rounded error equal to theirs are also candidates.
+	 */
+	Best = (Low == SolverPtr->NumSolutions) ? (Low - 1U) : Low;
+	Best_Error = XRFdc_GetPLLRateError(SamplingRate, SolutionsPtr[Best].SampleRate);
+	if ((Low > 0U) && (Low < SolverPtr->NumSolutions)) {
+		Error = XRFdc_GetPLLRateError(SamplingRate, SolutionsPtr[Low - 1U].SampleRate);
+		if ((Error < Best_Error) ||
+		    ((Error == Best_Error) && (SolutionsPtr[Low - 1U].Rank < SolutionsPtr[Best].Rank))) {
+			Best = Low - 1U;
+			Best_Error = Error;
+		}
+	}
+	for (Index = Best; Index > 0U; Index--) {
+		if (XRFdc_GetPLLRateError(SamplingRate, SolutionsPtr[Index - 1U].SampleRate) != Best_Error) {
+			break;
+		}
+		if (SolutionsPtr[Index - 1U].Rank < SolutionsPtr[Best].Rank) {
+			Best = Index - 1U;
+		}
+	}
+	for (Index = Low; Index < SolverPtr->NumSolutions; Index++) {
+		if (XRFdc_GetPLLRateError(SamplingRate, SolutionsPtr[Index].SampleRate) != Best_Error) {
+			break;
+		}
+		if (SolutionsPtr[Index].Rank < SolutionsPtr[Best].Rank) {
+			Best = Index;
+		}
+	}
+
+	*FeedbackDivPtr = SolutionsPtr[Best].FeedbackDivider;
+	*OutputDivPtr = SolutionsPtr[Best].OutputDivider;
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
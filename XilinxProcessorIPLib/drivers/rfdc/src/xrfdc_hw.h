@@ -110,6 +110,8 @@
 *                       the config structure.
 * 12.0  cog    01/07/23 Added VOP support for DC coupled DACs and removed VOP
 *                       support for ES1 Parts.
+*       agt    10/18/26 16-bit register accesses go through the active
+*                       register transaction, if any.
 *
 *</pre>
 *
@@ -2332,10 +2334,14 @@ extern "C" {
 *
 * @note     C-Style signature:
 *           u16 XRFdc_ReadReg16(XRFdc *InstancePtr, u32 BaseAddress. int RegOffset)
+*           Registers written in the active transaction read back the
+*           pending value.
 *
 ******************************************************************************/
 #define XRFdc_ReadReg16(InstancePtr, BaseAddress, RegOffset)                                                           \
-	XRFdc_In16((InstancePtr->io), ((u32)RegOffset + (u32)BaseAddress))
+	(((InstancePtr)->Txn != NULL) ?                                                                                \
+		 XRFdc_TxnRead16((InstancePtr), ((u32)RegOffset + (u32)BaseAddress)) :                                 \
+		 XRFdc_In16((InstancePtr->io), ((u32)RegOffset + (u32)BaseAddress)))
 
 /***************************************************************************/
 /**
@@ -2352,10 +2358,17 @@ extern "C" {
 * @note     C-Style signature:
 *	void XRFdc_WriteReg16(XRFdc *InstancePtr, u32 BaseAddress, int RegOffset,
 *	u16 RegisterValue)
+*	The write is deferred to XRFdc_TxnCommit() if a transaction is active.
 *
 ******************************************************************************/
 #define XRFdc_WriteReg16(InstancePtr, BaseAddress, RegOffset, RegisterValue)                                           \
-	XRFdc_Out16((InstancePtr->io), ((u32)RegOffset + (u32)BaseAddress), (u32)(RegisterValue))
+	do {                                                                                                           \
+		if ((InstancePtr)->Txn != NULL) {                                                                      \
+			XRFdc_TxnWrite16((InstancePtr), ((u32)RegOffset + (u32)BaseAddress), (u16)(RegisterValue));   \
+		} else {                                                                                               \
+			XRFdc_Out16((InstancePtr->io), ((u32)RegOffset + (u32)BaseAddress), (u32)(RegisterValue));    \
+		}                                                                                                      \
+	} while (0)
 
 /****************************************************************************/
 /**
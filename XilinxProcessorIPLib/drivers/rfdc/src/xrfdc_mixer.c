@@ -56,6 +56,9 @@
 * 11.0  cog    05/31/21 Upversion.
 * 11.1  cog    11/16/21 Upversion.
 *       cog    01/18/22 Added safety checks.
+* 12.0  agt    10/18/26 NCO frequency words are computed in fixed point.
+*       agt    10/18/26 Added XRFdc_RetuneMixers() to set several mixers in one
+*                       register transaction.
 * </pre>
 *
 ******************************************************************************/
@@ -64,6 +67,8 @@
 #include "xrfdc.h"
 
 /************************** Constant Definitions *****************************/
+#define XRFDC_NCO_FIXED_RATE_MAX 16384.0 /* MHz, rates scaled by 2^48 fit in 62 bits */
+#define XRFDC_NCO_FQWD_BITS 48U
 
 /**************************** Type Definitions *******************************/
 
@@ -291,7 +296,7 @@ u32 XRFdc_SetMixerSettings(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_
 		}
 
 		/* NCO Frequency */
-		Freq = ((NCOFreq * XRFDC_NCO_FREQ_MULTIPLIER) / SamplingRate);
+		Freq = XRFdc_GetNCOFreqWord(NCOFreq, SamplingRate);
 		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_LOW_OFFSET, (u16)Freq);
 		ReadReg = (Freq >> XRFDC_NCO_FQWD_MID_SHIFT) & XRFDC_NCO_FQWD_MID_MASK;
 		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_MID_OFFSET, (u16)ReadReg);
@@ -1156,4 +1161,117 @@ u32 XRFdc_GetDataType(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id)
 	return MixerInputDataType;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API computes the NCO frequency word of a frequency in fixed point.
+*
+* @param    NCOFreq is the NCO frequency in MHz, within +/- SamplingRate/2.
+* @param    SamplingRate is the sampling rate in MHz, below 16.384GHz.
+*
+* @return
+*           - NCO frequency word, NCOFreq * 2^48 / SamplingRate rounded
+*             towards zero.
+*
+* @note     Both frequencies are scaled by 2^48, which is exact for these
+*           ranges, and divided by shift and subtract, so the word is the
+*           exact quotient. The double precision division previously used
+*           could round it up by one where the quotient was just below an
+*           integer.
+*
+******************************************************************************/
+s64 XRFdc_GetNCOFreqWord(double NCOFreq, double SamplingRate)
+{
+	u64 Freq;
+	u64 Rate;
+	u64 Rem;
+	u64 Word;
+	u32 Bit;
+
+	Xil_AssertNonvoid((SamplingRate > 0) && (SamplingRate < XRFDC_NCO_FIXED_RATE_MAX));
+
+	Rate = (u64)(SamplingRate * XRFDC_NCO_FREQ_MULTIPLIER);
+	Freq = (u64)(((NCOFreq < 0) ? -NCOFreq : NCOFreq) * XRFDC_NCO_FREQ_MULTIPLIER);
+
+	Word = Freq / Rate;
+	Rem = Freq % Rate;
+	for (Bit = 0U; Bit < XRFDC_NCO_FQWD_BITS; Bit++) {
+		Rem <<= 1U;
+		Word <<= 1U;
+		if (Rem >= Rate) {
+			Rem -= Rate;
+			Word |= 1U;
+		}
+	}
+
+	return (NCOFreq < 0) ? -(s64)Word : (s64)Word;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets the mixer settings of several blocks with a single register
+* transaction. Registers written by more than one block, and the read
+* modify writes of each block, are issued once, and the NCO update events
+* of all the blocks are triggered together at the end.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    RetunePtr pointer to the blocks and their mixer settings.
+* @param    NumBlocks is the number of blocks to retune.
+* @param    EntriesPtr pointer to the transaction table, see
+*           XRFdc_TxnBegin().
+* @param    NumEntries is the number of entries of the transaction table.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if a block could not be set, the blocks before
+*             it are still retuned.
+*
+* @note     If a transaction is already active the blocks are set within it,
+*           and EntriesPtr is not used.
+*
+******************************************************************************/
+u32 XRFdc_RetuneMixers(XRFdc *InstancePtr, XRFdc_Mixer_Retune *RetunePtr, u32 NumBlocks, XRFdc_TxnEntry *EntriesPtr,
+		       u32 NumEntries)
+{
+	u32 Status;
+	u32 Index;
+	u8 OwnTxn;
+	XRFdc_Txn Txn;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(RetunePtr != NULL);
+
+	OwnTxn = (InstancePtr->Txn == NULL) ? 1U : 0U;
+	if (OwnTxn == 1U) {
+		Status = XRFdc_TxnBegin(InstancePtr, &Txn, EntriesPtr, NumEntries);
+		if (Status != XRFDC_SUCCESS) {
+			goto RETURN_PATH;
+		}
+	}
+
+	Status = XRFDC_SUCCESS;
+	for (Index = 0U; Index < NumBlocks; Index++) {
+		Status = XRFdc_SetMixerSettings(InstancePtr, RetunePtr[Index].Type, RetunePtr[Index].Tile_Id,
+						RetunePtr[Index].Block_Id, RetunePtr[Index].MixerSettingsPtr);
+		if (Status != XRFDC_SUCCESS) {
+			metal_log(METAL_LOG_ERROR, "\n Failed to retune %s %u block %u in %s\r\n",
+				  (RetunePtr[Index].Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", RetunePtr[Index].Tile_Id,
+				  RetunePtr[Index].Block_Id, __func__);
+			break;
+		}
+	}
+
+	/* Commit the blocks already set so the hardware matches the instance */
+	if (OwnTxn == 1U) {
+		(void)XRFdc_TxnCommit(InstancePtr);
+		metal_log(METAL_LOG_DEBUG, "\n %u blocks retuned with %u accesses, %u reads and %u writes in %s\r\n",
+			  Index, Txn.Accesses, Txn.Reads, Txn.Writes, __func__);
+	}
+
+RETURN_PATH:
+	return Status;
+}
+
 /** @} */
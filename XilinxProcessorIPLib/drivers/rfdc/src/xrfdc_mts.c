@@ -55,6 +55,11 @@
 *       cog    01/18/22 Added safety checks.
 *       cog    01/18/22 Add cast in XRFdc_MTS_Dtc_Calc.
 *       cog    01/18/22 Initialize DatapathMode in XRFdc_MTS_Latency.
+* 12.0  agt    10/18/26 Scan the DTCs of all the tiles in lock-step, waiting once
+*                       per code for the sysrefs of all of them.
+*       agt    10/18/26 Reload scans stop once the closest code to the target
+*                       is known.
+*       agt    10/18/26 Wait once for all the DAC tiles before reading markers.
 *
 * </pre>
 *
@@ -78,6 +83,7 @@
 #define XRFDC_MTS_DTC_COUNT 10U
 #define XRFDC_MTS_MARKER_COUNT 4U
 #define XRFDC_MTS_SRCOUNT_TIMEOUT 1000U
+#define XRFDC_MTS_DTC_UNSCANNED 4U
 #define XRFDC_MTS_DELAY_MAX 31U
 #define XRFDC_MTS_CHECK_ALL_FIFOS 0U
 
@@ -99,6 +105,9 @@
 #define XRFDC_MTS_DAC_MARKER_LOC_MASK(X) ((X < XRFDC_GEN3) ? 0x7U : 0xFU)
 #define XRFDC_MTS_RMW(read, mask, data) (((read) & ~(mask)) | ((data) & (mask)))
 #define XRFDC_MTS_FIELD(data, mask, shift) (((data) & (mask)) >> (shift))
+#define XRFDC_MTS_CLAMP(val, min, max) (((val) < (min)) ? (min) : (((val) > (max)) ? (max) : (val)))
+/* Tile scanned in position order, the reference tile then the others in order */
+#define XRFDC_MTS_SCAN_ORDER(order, ref) (((order) == 0U) ? (ref) : ((((order)-1U) < (ref)) ? ((order)-1U) : (order)))
 /************************** Function Prototypes ******************************/
 
 static void XRFdc_MTS_Sysref_TRx(XRFdc *InstancePtr, u32 Enable);
@@ -106,9 +115,12 @@ static void XRFdc_MTS_Sysref_Ctrl(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32
 				  u32 Enable_Div_Reset);
 static u32 XRFdc_MTS_Sysref_Dist(XRFdc *InstancePtr, int Num_DAC);
 static u32 XRFdc_MTS_Sysref_Count(XRFdc *InstancePtr, u32 Type, u32 Count_Val);
-static u32 XRFdc_MTS_Dtc_Scan(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, XRFdc_MTS_DTC_Settings *SettingsPtr);
-static u32 XRFdc_MTS_Dtc_Code(XRFdc *InstancePtr, u32 Type, u32 BaseAddr, u32 SRCtrlAddr, u32 DTCAddr, u16 SRctl,
-			      u16 SRclr_m, u32 Code);
+static u32 XRFdc_MTS_Dtc_Scan(XRFdc *InstancePtr, u32 Type, u32 Tiles, XRFdc_MTS_DTC_Settings *SettingsPtr);
+static void XRFdc_MTS_Dtc_Code(XRFdc *InstancePtr, u32 BaseAddr, u32 SRCtrlAddr, u32 DTCAddr, u16 SRctl, u16 SRclr_m,
+			       u32 Code);
+static int XRFdc_MTS_Dtc_Target(XRFdc_MTS_DTC_Settings *SettingsPtr, u32 Tile_Id, u32 RefDone);
+static u32 XRFdc_MTS_Dtc_Window_Done(u8 *FlagsPtr, int Lo, int Hi, int Target, int Min_Gap_Allowed);
+static u8 XRFdc_MTS_Dtc_Min_Gap(XRFdc *InstancePtr, XRFdc_MTS_DTC_Settings *SettingsPtr);
 static u32 XRFdc_MTS_Dtc_Calc(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, XRFdc_MTS_DTC_Settings *SettingsPtr,
 			      u8 *FlagsPtr);
 static void XRFdc_MTS_Dtc_Flag_Debug(u8 *FlagsPtr, u32 Type, u32 Tile_Id, u32 Target, u32 Picked);
@@ -329,6 +341,8 @@ static void XRFdc_MTS_Dtc_Flag_Debug(u8 *FlagsPtr, u32 Type, u32 Tile_Id, u32 Ta
 			buf[Index] = '*';
 		} else if (Index == Target) {
 			buf[Index] = '#';
+		} else if (FlagsPtr[Index] == XRFDC_MTS_DTC_UNSCANNED) {
+			buf[Index] = '.';
 		} else {
 			buf[Index] = '0' + FlagsPtr[Index];
 		}
@@ -341,6 +355,34 @@ static void XRFdc_MTS_Dtc_Flag_Debug(u8 *FlagsPtr, u32 Type, u32 Tile_Id, u32 Ta
 	(void)Tile_Id;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API gets the minimum gap between flagged DTC codes for a code between
+* them to be a candidate
+*
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    SettingsPtr dtc settings structure.
+*
+* @return
+* 		- Minimum gap.
+*
+* @note     None.
+*
+******************************************************************************/
+static u8 XRFdc_MTS_Dtc_Min_Gap(XRFdc *InstancePtr, XRFdc_MTS_DTC_Settings *SettingsPtr)
+{
+	u8 Min_Gap_Allowed;
+
+	if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
+		Min_Gap_Allowed = (SettingsPtr->IsPLL != 0U) ? XRFDC_MTS_MIN_GAP_PLL : XRFDC_MTS_MIN_GAP_T1;
+	} else {
+		Min_Gap_Allowed = XRFDC_MTS_MIN_GAP_GEN3;
+	}
+	return Min_Gap_Allowed;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -369,11 +411,7 @@ static u32 XRFdc_MTS_Dtc_Calc(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, XRFdc_M
 	u8 Min_Gap_Allowed;
 	int Codes[XRFDC_MTS_MAX_CODE] = { 0 };
 
-	if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
-		Min_Gap_Allowed = (SettingsPtr->IsPLL != 0U) ? XRFDC_MTS_MIN_GAP_PLL : XRFDC_MTS_MIN_GAP_T1;
-	} else {
-		Min_Gap_Allowed = XRFDC_MTS_MIN_GAP_GEN3;
-	}
+	Min_Gap_Allowed = XRFdc_MTS_Dtc_Min_Gap(InstancePtr, SettingsPtr);
 	Status = XRFDC_MTS_OK;
 
 	/* Scan the flags and find candidate DTC codes */
@@ -514,12 +552,12 @@ static u32 XRFdc_MTS_Dtc_Calc(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, XRFdc_M
 /*****************************************************************************/
 /**
 *
-* This API Set a DTC code and wait for it to be updated. Return early/late
-* flags, if set
+* This API Set a DTC code and clear the sysref capture of a tile. The early/late
+* flags are valid once the sysrefs have been counted, which the caller waits
+* for once for all the tiles being set.
 *
 *
 * @param    InstancePtr is a pointer to the XRfdc instance.
-* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
 * @param    BaseAddr is for internal usage.
 * @param    SRCtrlAddr is for internal usage.
 * @param    DTCAddr is for internal usage.
@@ -528,17 +566,14 @@ static u32 XRFdc_MTS_Dtc_Calc(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, XRFdc_M
 * @param    Code is for internal usage.
 *
 * @return
-* 		- XRFDC_MTS_OK if successful.
-*           - XRFDC_MTS_TIMEOUT if timeout occurs.
+* 		- None.
 *
 * @note     None.
 *
 ******************************************************************************/
-static u32 XRFdc_MTS_Dtc_Code(XRFdc *InstancePtr, u32 Type, u32 BaseAddr, u32 SRCtrlAddr, u32 DTCAddr, u16 SRctl,
-			      u16 SRclr_m, u32 Code)
+static void XRFdc_MTS_Dtc_Code(XRFdc *InstancePtr, u32 BaseAddr, u32 SRCtrlAddr, u32 DTCAddr, u16 SRctl, u16 SRclr_m,
+			       u32 Code)
 {
-	u32 Status;
-
 	/* set the DTC code */
 	XRFdc_WriteReg16(InstancePtr, BaseAddr, DTCAddr, Code);
 
@@ -547,84 +582,302 @@ static u32 XRFdc_MTS_Dtc_Code(XRFdc *InstancePtr, u32 Type, u32 BaseAddr, u32 SR
 
 	/* unset sysref cap clear */
 	XRFdc_WriteReg16(InstancePtr, BaseAddr, SRCtrlAddr, SRctl);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API gets the code a reload scan of a tile should pick the closest
+* code to.
+*
+*
+* @param    SettingsPtr dtc settings structure.
+* @param    Tile_Id Valid values are 0-3.
+* @param    RefDone is set if the code of the reference tile is known.
+*
+* @return
+* 		- Target code, or an estimate if the reference tile code is not
+* 		  known yet.
+*
+* @note     None.
+*
+******************************************************************************/
+static int XRFdc_MTS_Dtc_Target(XRFdc_MTS_DTC_Settings *SettingsPtr, u32 Tile_Id, u32 RefDone)
+{
+	int Target;
 
-	Status = XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_DTC_COUNT);
+	Target = SettingsPtr->Target[Tile_Id];
+	if ((Tile_Id != SettingsPtr->RefTile) && (RefDone != 0U)) {
+		Target = SettingsPtr->DTC_Code[SettingsPtr->RefTile] + SettingsPtr->Target[Tile_Id] -
+			 SettingsPtr->Target[SettingsPtr->RefTile];
+	}
+	return Target;
+}
 
-	return Status;
+/*****************************************************************************/
+/**
+*
+* This API checks if the scanned window of a reload scan holds the code that
+* the scan of all the DTC codes would pick.
+*
+* The closest code to the target, out of the gaps closed by flags within the
+* window, is at a distance Min_Diff. A gap running out of the window lies
+* beyond the gap of that code, so its code is further than Min_Diff from the
+* target if the window reaches 3 * Min_Diff + 2 codes either side of the
+* target.
+*
+*
+* @param    FlagsPtr is the flags of the scanned codes.
+* @param    Lo is the first scanned code.
+* @param    Hi is the last scanned code.
+* @param    Target is the code to get the closest code to.
+* @param    Min_Gap_Allowed is the minimum gap for a code.
+*
+* @return
+* 		- 1 if the window holds the code.
+* 		- 0 if more codes should be scanned.
+*
+* @note     None.
+*
+******************************************************************************/
+static u32 XRFdc_MTS_Dtc_Window_Done(u8 *FlagsPtr, int Lo, int Hi, int Target, int Min_Gap_Allowed)
+{
+	int Index;
+	int Last;
+	int Gap;
+	int Diff;
+	int Min_Diff;
+	int Reach;
+	u32 Closed;
+
+	if ((Lo == 0) && (Hi == (XRFDC_MTS_NUM_DTC - 1))) {
+		return 1U;
+	}
+
+	/* Codes -1 and XRFDC_MTS_NUM_DTC count as flagged, like in XRFdc_MTS_Dtc_Calc */
+	Min_Diff = XRFDC_MTS_NUM_DTC;
+	Last = Lo - 1;
+	Closed = (Lo == 0) ? 1U : 0U;
+	for (Index = Lo; Index <= (Hi + 1); Index++) {
+		if (Index <= Hi) {
+			if (FlagsPtr[Index] == 0U) {
+				continue;
+			}
+		} else if (Index != XRFDC_MTS_NUM_DTC) {
+			break;
+		}
+		Gap = Index - Last;
+		if ((Closed != 0U) && (Gap > Min_Gap_Allowed)) {
+			Diff = abs(Target - (Last + (Gap / 2)));
+			if (Diff < Min_Diff) {
+				Min_Diff = Diff;
+			}
+		}
+		Last = Index;
+		Closed = 1U;
+	}
+
+	if (Min_Diff == XRFDC_MTS_NUM_DTC) {
+		return 0U;
+	}
+
+	Reach = (3 * Min_Diff) + 2;
+	if (((Lo == 0) || ((Target - Lo) >= Reach)) && ((Hi == (XRFDC_MTS_NUM_DTC - 1)) || ((Hi - Target) >= Reach))) {
+		return 1U;
+	}
+	return 0U;
 }
 
 /*****************************************************************************/
 /**
 *
-* This API Scan the DTC codes and determine the optimal capture code for
-* both PLL and T1 cases
+* This API Scan the DTC codes of a group of tiles and determine the optimal
+* capture code for both PLL and T1 cases
+*
+* The tiles are scanned in lock-step, each step sets the next code of every
+* tile and waits once for the sysrefs to be captured, as the sysref counter is
+* shared by the tiles. An initial scan goes through all the codes. A reload
+* scan only goes out from the target of each tile until the closest code is
+* known, which gives the code the scan of all the codes would pick.
 *
 *
 * @param    InstancePtr is a pointer to the XRfdc instance.
 * @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
-* @param    Tile_Id Valid values are 0-3.
+* @param    Tiles is the mask of the tiles to scan.
 * @param    SettingsPtr dtc settings structure.
 *
 * @return
 * 		- XRFDC_MTS_OK if successful.
 *           - XRFDC_MTS_TIMEOUT if timeout occurs.
 *
-* @note     None.
+* @note     The codes are calculated in the order of a serial scan, the
+*           reference tile first.
 *
 ******************************************************************************/
-static u32 XRFdc_MTS_Dtc_Scan(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, XRFdc_MTS_DTC_Settings *SettingsPtr)
+static u32 XRFdc_MTS_Dtc_Scan(XRFdc *InstancePtr, u32 Type, u32 Tiles, XRFdc_MTS_DTC_Settings *SettingsPtr)
 {
 	u32 Status;
 	u32 BaseAddr;
 	u32 SRCtrlAddr;
 	u32 DTCAddr;
-	u8 Flags[XRFDC_MTS_NUM_DTC + 1];
-	u16 SRctl;
+	u8 Flags[XRFDC_TILE_ID4][XRFDC_MTS_NUM_DTC + 1];
+	u16 SRctl[XRFDC_TILE_ID4];
 	u16 SRclr_m;
 	u16 Flag_s;
 	u32 Index;
+	u32 Order;
+	u32 Tile_Id;
+	u32 Scanning;
+	u32 RefDone;
+	u32 Done;
+	u32 Steps;
+	int Lo[XRFDC_TILE_ID4];
+	int Hi[XRFDC_TILE_ID4];
+	int Code[XRFDC_TILE_ID4];
+	int Target;
 
-	BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
 	Status = XRFDC_MTS_OK;
-
-	/*  Enable SysRef Capture and Disable Divide Reset */
-	XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, Tile_Id, SettingsPtr->IsPLL, 1, 0);
 	SRCtrlAddr = (SettingsPtr->IsPLL != 0U) ? XRFDC_MTS_SRCAP_PLL : XRFDC_MTS_SRCAP_T1;
 	DTCAddr = (SettingsPtr->IsPLL != 0U) ? XRFDC_MTS_SRDTC_PLL : XRFDC_MTS_SRDTC_T1;
 	SRclr_m = (SettingsPtr->IsPLL != 0U) ? XRFDC_MTS_SRCLR_PLL_M : XRFDC_MTS_SRCLR_T1_M;
 	Flag_s = (SettingsPtr->IsPLL != 0U) ? XRFDC_MTS_SRFLAG_PLL : XRFDC_MTS_SRFLAG_T1;
 
-	SRctl = XRFdc_ReadReg16(InstancePtr, BaseAddr, SRCtrlAddr) & ~SRclr_m;
+	for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+		if ((Tiles & (1U << Tile_Id)) == 0U) {
+			continue;
+		}
+		BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
 
-	for (Index = 0U; Index < XRFDC_MTS_NUM_DTC; Index++) {
-		Flags[Index] = 0U;
+		/*  Enable SysRef Capture and Disable Divide Reset */
+		XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, Tile_Id, SettingsPtr->IsPLL, 1, 0);
+		SRctl[Tile_Id] = XRFdc_ReadReg16(InstancePtr, BaseAddr, SRCtrlAddr) & ~SRclr_m;
+
+		for (Index = 0U; Index < XRFDC_MTS_NUM_DTC; Index++) {
+			Flags[Tile_Id][Index] =
+				(SettingsPtr->Scan_Mode == XRFDC_MTS_SCAN_INIT) ? 0U : XRFDC_MTS_DTC_UNSCANNED;
+		}
+
+		/* Start from the target of a reload scan */
+		Target = 0;
+		if (SettingsPtr->Scan_Mode != XRFDC_MTS_SCAN_INIT) {
+			Target = XRFdc_MTS_Dtc_Target(SettingsPtr, Tile_Id, 0U);
+			Target = XRFDC_MTS_CLAMP(Target, 0, (int)XRFDC_MTS_NUM_DTC - 1);
+		}
+		Lo[Tile_Id] = Target;
+		Hi[Tile_Id] = Target - 1;
 	}
-	for (Index = 0U; (Index < XRFDC_MTS_NUM_DTC) && (Status == XRFDC_MTS_OK); Index++) {
-		Status |= XRFdc_MTS_Dtc_Code(InstancePtr, Type, BaseAddr, SRCtrlAddr, DTCAddr, SRctl, SRclr_m, Index);
-		Flags[Index] = (XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_MTS_SRFLAG) >> Flag_s) & 0x3U;
+
+	/* The other tiles wait for the reference tile code if it is scanned */
+	RefDone = ((Tiles & (1U << SettingsPtr->RefTile)) == 0U) ? 1U : 0U;
+	Scanning = Tiles;
+	Steps = 0U;
+	while ((Scanning != 0U) && (Status == XRFDC_MTS_OK)) {
+		/* Set the next code of each tile and wait once for all of them */
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			if ((Scanning & (1U << Tile_Id)) == 0U) {
+				continue;
+			}
+			Target = XRFdc_MTS_Dtc_Target(SettingsPtr, Tile_Id, RefDone);
+			if ((Hi[Tile_Id] < ((int)XRFDC_MTS_NUM_DTC - 1)) &&
+			    ((Lo[Tile_Id] == 0) || ((Hi[Tile_Id] - Target) <= (Target - Lo[Tile_Id])))) {
+				Hi[Tile_Id]++;
+				Code[Tile_Id] = Hi[Tile_Id];
+			} else {
+				Lo[Tile_Id]--;
+				Code[Tile_Id] = Lo[Tile_Id];
+			}
+			BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
+			XRFdc_MTS_Dtc_Code(InstancePtr, BaseAddr, SRCtrlAddr, DTCAddr, SRctl[Tile_Id], SRclr_m,
+					   Code[Tile_Id]);
+		}
+
+		Status |= XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_DTC_COUNT);
+		Steps++;
+
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			if ((Scanning & (1U << Tile_Id)) != 0U) {
+				BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
+				Flags[Tile_Id][Code[Tile_Id]] =
+					(XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_MTS_SRFLAG) >> Flag_s) & 0x3U;
+			}
+		}
+
+		/* Calculate the best DTC code of the tiles done, reference tile first */
+		for (Order = XRFDC_TILE_ID0; Order < XRFDC_TILE_ID4; Order++) {
+			Tile_Id = XRFDC_MTS_SCAN_ORDER(Order, SettingsPtr->RefTile);
+			if ((Scanning & (1U << Tile_Id)) == 0U) {
+				continue;
+			}
+			if (SettingsPtr->Scan_Mode == XRFDC_MTS_SCAN_INIT) {
+				Done = (Hi[Tile_Id] == ((int)XRFDC_MTS_NUM_DTC - 1)) ? 1U : 0U;
+			} else if ((Tile_Id != SettingsPtr->RefTile) && (RefDone == 0U)) {
+				Done = 0U;
+			} else {
+				Done = XRFdc_MTS_Dtc_Window_Done(Flags[Tile_Id], Lo[Tile_Id], Hi[Tile_Id],
+								 XRFdc_MTS_Dtc_Target(SettingsPtr, Tile_Id, RefDone),
+								 XRFdc_MTS_Dtc_Min_Gap(InstancePtr, SettingsPtr));
+			}
+			if (Done != 0U) {
+				(void)XRFdc_MTS_Dtc_Calc(InstancePtr, Type, Tile_Id, SettingsPtr, Flags[Tile_Id]);
+				Scanning &= ~(1U << Tile_Id);
+				if (Tile_Id == SettingsPtr->RefTile) {
+					RefDone = 1U;
+				}
+			}
+		}
 	}
 
-	/* Calculate the best DTC code */
-	(void)XRFdc_MTS_Dtc_Calc(InstancePtr, Type, Tile_Id, SettingsPtr, Flags);
+	/* On timeout, calculate the codes of the tiles left from what was scanned */
+	for (Order = XRFDC_TILE_ID0; Order < XRFDC_TILE_ID4; Order++) {
+		Tile_Id = XRFDC_MTS_SCAN_ORDER(Order, SettingsPtr->RefTile);
+		if ((Scanning & (1U << Tile_Id)) != 0U) {
+			(void)XRFdc_MTS_Dtc_Calc(InstancePtr, Type, Tile_Id, SettingsPtr, Flags[Tile_Id]);
+		}
+	}
+	metal_log(METAL_LOG_DEBUG, "%s DTC scan of tiles 0x%x in %u steps\n", (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC",
+		  Tiles, Steps);
 
-	/* Program the calculated code */
-	if (SettingsPtr->DTC_Code[Tile_Id] == -1) {
-		metal_log(METAL_LOG_ERROR, "Unable to capture analog SysRef safely on %s tile %d\n",
-			  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id);
-		Status |= XRFDC_MTS_DTC_INVALID;
-	} else {
-		(void)XRFdc_MTS_Dtc_Code(InstancePtr, Type, BaseAddr, SRCtrlAddr, DTCAddr, SRctl, SRclr_m,
-					 SettingsPtr->DTC_Code[Tile_Id]);
+	/* Program the calculated codes */
+	Done = 0U;
+	for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+		if ((Tiles & (1U << Tile_Id)) == 0U) {
+			continue;
+		}
+		if (SettingsPtr->DTC_Code[Tile_Id] == -1) {
+			metal_log(METAL_LOG_ERROR, "Unable to capture analog SysRef safely on %s tile %d\n",
+				  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id);
+			Status |= XRFDC_MTS_DTC_INVALID;
+		} else {
+			BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
+			XRFdc_MTS_Dtc_Code(InstancePtr, BaseAddr, SRCtrlAddr, DTCAddr, SRctl[Tile_Id], SRclr_m,
+					   SettingsPtr->DTC_Code[Tile_Id]);
+			Done = 1U;
+		}
+	}
+	if (Done != 0U) {
+		(void)XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_DTC_COUNT);
 	}
 
 	if (SettingsPtr->IsPLL != 0U) {
 		/* PLL - Disable SysRef Capture */
-		XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, Tile_Id, 1, 0, 0);
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			if ((Tiles & (1U << Tile_Id)) != 0U) {
+				XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, Tile_Id, 1, 0, 0);
+			}
+		}
 	} else {
 		/* T1 - Reset Dividers */
-		XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, Tile_Id, 0, 1, 1);
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			if ((Tiles & (1U << Tile_Id)) != 0U) {
+				XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, Tile_Id, 0, 1, 1);
+			}
+		}
 		Status |= XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_DTC_COUNT);
-		XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, Tile_Id, 0, 1, 0);
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			if ((Tiles & (1U << Tile_Id)) != 0U) {
+				XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, Tile_Id, 0, 1, 0);
+			}
+		}
 	}
 	return Status;
 }
@@ -633,55 +886,59 @@ static u32 XRFdc_MTS_Dtc_Scan(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, XRFdc_M
 /**
 *
 * This API Scans the DTC codes and determine the optimal capture code for
-* PLL cases
+* PLL cases, for the tiles using their PLL
 *
 *
 * @param    InstancePtr is a pointer to the XRfdc instance.
 * @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
-* @param    Tile_Id Valid values are 0-3.
-* @param    SettingsPtr dtc settings structure.
+* @param    ConfigPtr Multi-tile sync config structure.
 *
 * @return
 *         - XRFDC_MTS_OK if successful.
 *         - XRFDC_MTS_TIMEOUT if timeout occurs.
 *
-* @note     None.
+* @note     The reference tile is scanned even if not in the group.
 *
 ******************************************************************************/
-static u32 XRFdc_MTS_Dtc_Scan_PLL(XRFdc *InstancePtr, u32 Type, u32 Tile_Id,
-				  XRFdc_MultiConverter_Sync_Config *ConfigPtr)
+static u32 XRFdc_MTS_Dtc_Scan_PLL(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter_Sync_Config *ConfigPtr)
 {
 	u32 Status;
 	u32 BaseAddr;
 	u32 NetCtrlReg;
 	u32 DistCtrlReg;
+	u32 Tile_Id;
+	u32 Tiles;
 
 	Status = XRFDC_MTS_OK;
-	BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
-	if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
-		NetCtrlReg = XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_MTS_CLKSTAT);
-		if ((NetCtrlReg & XRFDC_MTS_PLLEN_M) != XRFDC_DISABLED) {
-			/* DTC Scan PLL */
-			if (Tile_Id == ConfigPtr->RefTile) {
-				metal_log(METAL_LOG_INFO, "\nDTC Scan PLL\n");
-			}
-			ConfigPtr->DTC_Set_PLL.RefTile = ConfigPtr->RefTile;
-			Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, Tile_Id, &ConfigPtr->DTC_Set_PLL);
+	Tiles = 0U;
+	for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+		if ((Tile_Id != ConfigPtr->RefTile) && ((ConfigPtr->Tiles & (1U << Tile_Id)) == 0U)) {
+			continue;
 		}
-	} else {
-		NetCtrlReg = XRFdc_RDReg(InstancePtr, BaseAddr, XRFDC_CLK_NETWORK_CTRL1,
-					 (XRFDC_NET_CTRL_CLK_T1_SRC_LOCAL | XRFDC_NET_CTRL_CLK_T1_SRC_DIST));
-		DistCtrlReg =
-			XRFdc_RDReg(InstancePtr, BaseAddr, XRFDC_HSCOM_CLK_DSTR_OFFSET, XRFDC_DIST_CTRL_DIST_SRC_PLL);
-
-		if ((NetCtrlReg == XRFDC_DISABLED) || (DistCtrlReg != XRFDC_DISABLED)) {
-			/* DTC Scan PLL */
-			if (Tile_Id == ConfigPtr->RefTile) {
-				metal_log(METAL_LOG_INFO, "\nDTC Scan PLL\n");
+		BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
+		if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
+			NetCtrlReg = XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_MTS_CLKSTAT);
+			if ((NetCtrlReg & XRFDC_MTS_PLLEN_M) != XRFDC_DISABLED) {
+				Tiles |= (1U << Tile_Id);
 			}
-			ConfigPtr->DTC_Set_PLL.RefTile = ConfigPtr->RefTile;
-			Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, Tile_Id, &ConfigPtr->DTC_Set_PLL);
+		} else {
+			NetCtrlReg = XRFdc_RDReg(InstancePtr, BaseAddr, XRFDC_CLK_NETWORK_CTRL1,
+						 (XRFDC_NET_CTRL_CLK_T1_SRC_LOCAL | XRFDC_NET_CTRL_CLK_T1_SRC_DIST));
+			DistCtrlReg = XRFdc_RDReg(InstancePtr, BaseAddr, XRFDC_HSCOM_CLK_DSTR_OFFSET,
+						  XRFDC_DIST_CTRL_DIST_SRC_PLL);
+			if ((NetCtrlReg == XRFDC_DISABLED) || (DistCtrlReg != XRFDC_DISABLED)) {
+				Tiles |= (1U << Tile_Id);
+			}
+		}
+	}
+
+	if (Tiles != 0U) {
+		/* DTC Scan PLL */
+		if ((Tiles & (1U << ConfigPtr->RefTile)) != 0U) {
+			metal_log(METAL_LOG_INFO, "\nDTC Scan PLL\n");
 		}
+		ConfigPtr->DTC_Set_PLL.RefTile = ConfigPtr->RefTile;
+		Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, Tiles, &ConfigPtr->DTC_Set_PLL);
 	}
 
 	return Status;
@@ -890,15 +1147,19 @@ static u32 XRFdc_MTS_GetMarker(XRFdc *InstancePtr, u32 Type, u32 Tiles, XRFdc_MT
 	/* Allow the marker counter to run */
 	Status |= XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_MARKER_COUNT);
 
-	/* Read master FIFO (FIFO0 in each Tile) */
-	for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
-		if (((1U << Tile_Id) & Tiles) != 0U) {
-			if (Type == XRFDC_DAC_TILE) {
-				/* Disable SysRef Capture before reading it */
+	if (Type == XRFDC_DAC_TILE) {
+		/* Disable SysRef Capture before reading it, waiting once for all the tiles */
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			if (((1U << Tile_Id) & Tiles) != 0U) {
 				XRFdc_MTS_Sysref_Ctrl(InstancePtr, XRFDC_DAC_TILE, Tile_Id, 0, 0, 0);
-				Status |= XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_MARKER_COUNT);
 			}
+		}
+		Status |= XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_MARKER_COUNT);
+	}
 
+	/* Read master FIFO (FIFO0 in each Tile) */
+	for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+		if (((1U << Tile_Id) & Tiles) != 0U) {
 			XRFdc_MTS_Marker_Read(InstancePtr, Type, Tile_Id, 0, &Count, &Loc, &Done);
 			MarkersPtr->Count[Tile_Id] = Count;
 			MarkersPtr->Loc[Tile_Id] = Loc;
@@ -1333,29 +1594,14 @@ u32 XRFdc_MultiConverter_Sync(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter
 	/* Update distribution */
 	Status |= XRFdc_MTS_Sysref_Dist(InstancePtr, -1);
 
-	/* Scan DTCs for each tile starting with the reference tile */
-	Status |= XRFdc_MTS_Dtc_Scan_PLL(InstancePtr, Type, ConfigPtr->RefTile, ConfigPtr);
-	for (Index = XRFDC_TILE_ID0; Index < XRFDC_TILE_ID4; Index++) {
-		if (Index == ConfigPtr->RefTile) {
-			continue;
-		}
-		if ((ConfigPtr->Tiles & (1U << Index)) != 0U) {
-			/* Run DTC Scan for PLL */
-			Status |= XRFdc_MTS_Dtc_Scan_PLL(InstancePtr, Type, Index, ConfigPtr);
-		}
-	}
-	/* Scan DTCs for each tile T1 starting with the reference tile */
+	/* Scan the DTCs of the tiles together, the reference tile sets the targets */
+	Status |= XRFdc_MTS_Dtc_Scan_PLL(InstancePtr, Type, ConfigPtr);
+
+	/* Scan the T1 DTCs of the tiles together, the reference tile sets the targets */
 	metal_log(METAL_LOG_INFO, "\nDTC Scan T1\n");
 	ConfigPtr->DTC_Set_T1.RefTile = ConfigPtr->RefTile;
-	Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, ConfigPtr->RefTile, &ConfigPtr->DTC_Set_T1);
-	for (Index = XRFDC_TILE_ID0; Index < XRFDC_TILE_ID4; Index++) {
-		if ((ConfigPtr->Tiles & (1U << Index)) != 0U) {
-			if (Index == ConfigPtr->RefTile) {
-				continue;
-			}
-			Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, Index, &ConfigPtr->DTC_Set_T1);
-		}
-	}
+	Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, ConfigPtr->Tiles | (1U << ConfigPtr->RefTile),
+				     &ConfigPtr->DTC_Set_T1);
 
 	/* Enable FIFOs */
 	XRFdc_MTS_FIFOCtrl(InstancePtr, Type, XRFDC_MTS_FIFO_ENABLE, ConfigPtr->Tiles);
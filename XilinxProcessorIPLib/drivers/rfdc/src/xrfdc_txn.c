@@ -0,0 +1,337 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xrfdc_txn.c
+* @addtogroup Overview
+* @{
+*
+* Contains the register transaction functions of the XRFdc driver.
+* See xrfdc.h for a detailed description of the device and driver.
+*
+* While a transaction is active, the 16-bit register writes made by the
+* driver APIs are kept in a table rather than issued on the bus. A register
+* written several times is written once, in the place of its last write, so
+* the writes reach the hardware in the order of the last write of each
+* register. The read half of later read modify writes is served from the
+* table. Reads of registers not
+* written in the transaction, such as status registers, still go to the
+* hardware.
+*
+* The update dynamic event registers are written last on commit, after the
+* configuration of all the tiles, so the events of all the tiles written in
+* the transaction are triggered together. Event bits written to the same
+* register are merged.
+*
+* Only configuration APIs, ex, mixer, QMC, coarse delay, decimation and
+* interpolation settings, should be called within a transaction. APIs which
+* poll the hardware for the effect of their writes should not.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 12.0  agt    10/18/26 Initial release.
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xrfdc.h"
+
+/************************** Constant Definitions *****************************/
+#define XRFDC_TXN_TILE_SIZE 0x4000U
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* Checks if a register is an update dynamic event register.
+*
+* @param    Addr is the register offset in the IP.
+*
+* @return
+*           - 1 if the register triggers update events.
+*           - 0 otherwise.
+*
+* @note     Static API used only in this file.
+*
+******************************************************************************/
+static u8 XRFdc_TxnIsEvent(u32 Addr)
+{
+	u32 Local;
+	u32 EventOffset;
+
+	if ((Addr < XRFDC_DAC_TILE_CTRL_STATS_ADDR(0U)) || (Addr >= XRFDC_ADC_TILE_CTRL_STATS_ADDR(4U))) {
+		return 0U;
+	}
+
+	/* Offset in the tile DRP */
+	Local = (Addr - XRFDC_DAC_TILE_CTRL_STATS_ADDR(0U)) % XRFDC_TXN_TILE_SIZE;
+	if (Local < XRFDC_TILE_DRP_OFFSET) {
+		return 0U;
+	}
+	Local -= XRFDC_TILE_DRP_OFFSET;
+
+	if (Local == (XRFDC_HSCOM_ADDR + XRFDC_HSCOM_UPDT_DYN_OFFSET)) {
+		return 1U;
+	}
+
+	EventOffset = (Addr >= XRFDC_ADC_TILE_CTRL_STATS_ADDR(0U)) ? XRFDC_ADC_UPDATE_DYN_OFFSET :
+								     XRFDC_DAC_UPDATE_DYN_OFFSET;
+	if ((Local < XRFDC_BLOCK_ADDR_OFFSET(4U)) && ((Local % XRFDC_BLOCK_ADDR_OFFSET(1U)) == EventOffset)) {
+		return 1U;
+	}
+
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* Finds the pending write of a register.
+*
+* @param    TxnPtr is a pointer to the transaction.
+* @param    Addr is the register offset in the IP.
+*
+* @return
+*           - Pointer to the entry of the register.
+*           - NULL if the register has no pending write.
+*
+* @note     Static API used only in this file.
+*
+******************************************************************************/
+static XRFdc_TxnEntry *XRFdc_TxnFind(XRFdc_Txn *TxnPtr, u32 Addr)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < TxnPtr->NumEntries; Index++) {
+		if (TxnPtr->Entries[Index].Addr == Addr) {
+			return &TxnPtr->Entries[Index];
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* Issues the pending writes on the bus, the update dynamic event registers
+* last, and empties the table.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    TxnPtr is a pointer to the transaction.
+*
+* @return
+*           - None
+*
+* @note     Static API used only in this file.
+*
+******************************************************************************/
+static void XRFdc_TxnFlush(XRFdc *InstancePtr, XRFdc_Txn *TxnPtr)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < TxnPtr->NumEntries; Index++) {
+		if (TxnPtr->Entries[Index].Event == 0U) {
+			XRFdc_Out16(InstancePtr->io, TxnPtr->Entries[Index].Addr, TxnPtr->Entries[Index].Value);
+			TxnPtr->Writes++;
+		}
+	}
+
+	for (Index = 0U; Index < TxnPtr->NumEntries; Index++) {
+		if (TxnPtr->Entries[Index].Event != 0U) {
+			XRFdc_Out16(InstancePtr->io, TxnPtr->Entries[Index].Addr, TxnPtr->Entries[Index].Value);
+			TxnPtr->Writes++;
+		}
+	}
+
+	TxnPtr->NumEntries = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API starts a register transaction. Until XRFdc_TxnCommit() is called,
+* the 16-bit register writes of the driver are deferred and coalesced.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    TxnPtr is a pointer to the transaction.
+* @param    EntriesPtr is a pointer to the table of pending writes.
+* @param    NumEntries is the number of entries of the table. One entry is
+*           used per register written.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if a transaction is already active.
+*
+* @note     If the table fills up, the pending writes are issued and the
+*           transaction goes on with an empty table.
+*
+******************************************************************************/
+u32 XRFdc_TxnBegin(XRFdc *InstancePtr, XRFdc_Txn *TxnPtr, XRFdc_TxnEntry *EntriesPtr, u32 NumEntries)
+{
+	u32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(TxnPtr != NULL);
+	Xil_AssertNonvoid(EntriesPtr != NULL);
+	Xil_AssertNonvoid(NumEntries != 0U);
+
+	if (InstancePtr->Txn != NULL) {
+		metal_log(METAL_LOG_ERROR, "\n Register transaction already active in %s\r\n", __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	TxnPtr->Entries = EntriesPtr;
+	TxnPtr->MaxEntries = NumEntries;
+	TxnPtr->NumEntries = 0U;
+	TxnPtr->Accesses = 0U;
+	TxnPtr->Reads = 0U;
+	TxnPtr->Writes = 0U;
+	InstancePtr->Txn = TxnPtr;
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API ends the active register transaction, and issues its pending
+* writes. The update dynamic event registers are written after all the
+* other registers.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if no transaction is active.
+*
+* @note     The Accesses, Reads and Writes fields of the transaction give
+*           the register accesses made by the driver and the bus operations
+*           issued for them.
+*
+******************************************************************************/
+u32 XRFdc_TxnCommit(XRFdc *InstancePtr)
+{
+	u32 Status;
+	XRFdc_Txn *TxnPtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	TxnPtr = InstancePtr->Txn;
+	if (TxnPtr == NULL) {
+		metal_log(METAL_LOG_ERROR, "\n No register transaction active in %s\r\n", __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	XRFdc_TxnFlush(InstancePtr, TxnPtr);
+	InstancePtr->Txn = NULL;
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* Reads a 16-bit register within the active transaction.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Addr is the register offset in the IP.
+*
+* @return
+*           - Pending value if the register was written in the transaction,
+*             otherwise the register value.
+*
+* @note     Called through XRFdc_ReadReg16().
+*
+******************************************************************************/
+u16 XRFdc_TxnRead16(XRFdc *InstancePtr, u32 Addr)
+{
+	XRFdc_Txn *TxnPtr = InstancePtr->Txn;
+	XRFdc_TxnEntry *EntryPtr;
+
+	TxnPtr->Accesses++;
+
+	EntryPtr = XRFdc_TxnFind(TxnPtr, Addr);
+	if (EntryPtr != NULL) {
+		return EntryPtr->Value;
+	}
+
+	TxnPtr->Reads++;
+	return XRFdc_In16(InstancePtr->io, Addr);
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes a 16-bit register within the active transaction.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Addr is the register offset in the IP.
+* @param    Data is the value to be written.
+*
+* @return
+*           - None
+*
+* @note     Called through XRFdc_WriteReg16().
+*
+******************************************************************************/
+void XRFdc_TxnWrite16(XRFdc *InstancePtr, u32 Addr, u16 Data)
+{
+	XRFdc_Txn *TxnPtr = InstancePtr->Txn;
+	XRFdc_TxnEntry *EntryPtr;
+
+	TxnPtr->Accesses++;
+
+	EntryPtr = XRFdc_TxnFind(TxnPtr, Addr);
+	if (EntryPtr != NULL) {
+		/* Each event written is triggered, so keep all the bits */
+		if (EntryPtr->Event != 0U) {
+			EntryPtr->Value |= Data;
+			return;
+		}
+
+		/* Move the register behind the writes made since its last write */
+		for (; EntryPtr < &TxnPtr->Entries[TxnPtr->NumEntries - 1U]; EntryPtr++) {
+			*EntryPtr = *(EntryPtr + 1);
+		}
+		EntryPtr->Addr = Addr;
+		EntryPtr->Value = Data;
+		EntryPtr->Event = 0U;
+		return;
+	}
+
+	if (TxnPtr->NumEntries == TxnPtr->MaxEntries) {
+		metal_log(METAL_LOG_DEBUG, "\n Register transaction table full, flushing in %s\r\n", __func__);
+		XRFdc_TxnFlush(InstancePtr, TxnPtr);
+	}
+
+	EntryPtr = &TxnPtr->Entries[TxnPtr->NumEntries++];
+	EntryPtr->Addr = Addr;
+	EntryPtr->Value = Data;
+	EntryPtr->Event = XRFdc_TxnIsEvent(Addr);
+}
+/** @} */
@@ -182,6 +182,9 @@ s32 XSdPs_CfgInitialize(XSdPs *InstancePtr, XSdPs_Config *ConfigPtr,
 	InstancePtr->IsBusy = FALSE;
 	InstancePtr->BlkSize = 0U;
 	InstancePtr->IsTuningDone = 0U;
+	InstancePtr->ReqHead = 0U;
+	InstancePtr->ReqCount = 0U;
+	InstancePtr->ReqIntrEn = FALSE;
 
 	/* Host Controller version is read. */
 	InstancePtr->HC_Version =
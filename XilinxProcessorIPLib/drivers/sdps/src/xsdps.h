@@ -64,8 +64,12 @@
 * descriptor table and hence care will have to be taken to call read/write
 * API's in a loop for large file sizes.
 *
-* Interrupt mode is not supported because it offers no improvement when used
-* with file system.
+* Interrupt mode is not supported for the polled APIs because it offers no
+* improvement when used with file system. Applications which need to overlap
+* SD transfers with other work can queue requests with XSdPs_SubmitRequest()
+* and retire them with XSdPs_PollRequests(), either from a polling loop or
+* from the SD interrupt handler after enabling the request interrupts with
+* XSdPs_SetRequestIntr().
 *
 * <b>eMMC support</b>
 *
@@ -161,6 +165,8 @@
 * 4.1   sa     01/03/23 Report error if Transfer size is greater than 2MB.
 * 4.1	sa     12/19/22 Enable eMMC HS400 mode for Versal Net.
 * 	sa     01/25/23	Use instance structure to store DMA descriptor tables.
+* 4.2   agt    10/18/26 Added queued asynchronous request API with
+*                       completion callbacks and scatter-gather buffers.
 *
 * </pre>
 *
@@ -237,6 +243,9 @@ extern "C" {
 
 /** @} */
 
+#define XSDPS_REQ_QUEUE_DEPTH	8U	/**< Maximum queued requests */
+#define XSDPS_ADMA2_DESC_NUM	32U	/**< ADMA2 descriptors per table */
+
 /**************************** Type Definitions *******************************/
 
 /**
@@ -264,6 +273,35 @@ typedef struct {
 	u32 OTapDly_SDR_Clk200;	/**< Input Tap delay for SDR104/HS200 modes */
 } XSdPs_Config;
 
+/**
+ * Completion handler of a queued request. Status is XST_SUCCESS if the
+ * request completed successfully and XST_FAILURE otherwise.
+ */
+typedef void (*XSdPs_Handler)(void *CallBackRef, s32 Status);
+
+/**
+ * Buffer segment of a scatter-gather request
+ */
+typedef struct {
+	u8 *Buff;		/**< Segment buffer */
+	u32 Len;		/**< Segment length in bytes, multiple of block size */
+} XSdPs_IoVec;
+
+/**
+ * Read or write request queued with XSdPs_SubmitRequest(). The request and
+ * its segments are owned by the driver until the handler is called.
+ */
+typedef struct {
+	u32 Arg;		/**< Card address, as passed to XSdPs_ReadPolled() */
+	u32 BlkCnt;		/**< Number of blocks to transfer */
+	XSdPs_IoVec *IoVec;	/**< Buffer segments */
+	u32 IoVecCnt;		/**< Number of buffer segments */
+	u8 IsWrite;		/**< TRUE for write, FALSE for read */
+	XSdPs_Handler Handler;	/**< Completion handler, may be NULL */
+	void *CallBackRef;	/**< Argument passed to the handler */
+	s32 Status;		/**< Completion status of the request */
+} XSdPs_Request;
+
 /**
  * ADMA2 32-Bit descriptor table
  */
@@ -323,13 +361,18 @@ typedef struct {
 	u8  IsBusy;			/**< Busy Flag*/
 	u32 BlkSize;		/**< Block Size*/
 	u8  IsTuningDone;	/**< Flag to indicate HS200 tuning complete */
+	XSdPs_Request *ReqQueue[XSDPS_REQ_QUEUE_DEPTH];	/**< Queued requests,
+							the head one is in flight */
+	u8  ReqHead;		/**< Index of the request in flight */
+	u8  ReqCount;		/**< Number of queued requests */
+	u8  ReqIntrEn;		/**< Signal interrupts for queued requests */
 #ifdef __ICCARM__
 #pragma data_alignment = 32
-	XSdPs_Adma2Descriptor32 Adma2_DescrTbl32[32];
-	XSdPs_Adma2Descriptor64 Adma2_DescrTbl64[32];
+	XSdPs_Adma2Descriptor32 Adma2_DescrTbl32[XSDPS_ADMA2_DESC_NUM];
+	XSdPs_Adma2Descriptor64 Adma2_DescrTbl64[XSDPS_ADMA2_DESC_NUM];
 #else
-	XSdPs_Adma2Descriptor32 Adma2_DescrTbl32[32] __attribute__ ((aligned(32)));
-	XSdPs_Adma2Descriptor64 Adma2_DescrTbl64[32] __attribute__ ((aligned(32)));
+	XSdPs_Adma2Descriptor32 Adma2_DescrTbl32[XSDPS_ADMA2_DESC_NUM] __attribute__ ((aligned(32)));
+	XSdPs_Adma2Descriptor64 Adma2_DescrTbl64[XSDPS_ADMA2_DESC_NUM] __attribute__ ((aligned(32)));
 #endif
 } XSdPs;
 
@@ -380,6 +423,10 @@ s32 XSdPs_CheckReadTransfer(XSdPs *InstancePtr);
 s32 XSdPs_StartWriteTransfer(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, u8 *Buff);
 s32 XSdPs_CheckWriteTransfer(XSdPs *InstancePtr);
 s32 XSdPs_Erase(XSdPs *InstancePtr, u32 StartAddr, u32 EndAddr);
+s32 XSdPs_SubmitRequest(XSdPs *InstancePtr, XSdPs_Request *ReqPtr);
+s32 XSdPs_PollRequests(XSdPs *InstancePtr);
+void XSdPs_SetRequestIntr(XSdPs *InstancePtr, u8 Enable);
+void XSdPs_RequestIntrHandler(void *CallBackRef);
 
 #ifdef __cplusplus
 }
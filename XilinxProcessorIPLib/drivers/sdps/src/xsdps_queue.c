@@ -0,0 +1,541 @@
+/******************************************************************************
+* Copyright (c) 2022 - 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsdps_queue.c
+* @addtogroup sdps Overview
+* @{
+*
+* The xsdps_queue.c file contains the queued, non-blocking read and write
+* APIs. Requests are kept in a small queue in the instance. The head request
+* is in flight on the controller and the next one is started as soon as it
+* completes, from XSdPs_PollRequests() or from the SD interrupt handler.
+* See xsdps.h for a detailed description of the device and driver.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.2   agt    10/18/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xsdps_core.h"
+
+/************************** Constant Definitions *****************************/
+#define XSDPS_REQ_INTR_MASK	(XSDPS_INTR_TC_MASK | XSDPS_INTR_ERR_MASK)
+					/**< Interrupts signalled for requests */
+#define XSDPS_CMD23_BLKCNT_MASK	0x0000FFFFU	/**< CMD23 block count */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static s32 XSdPs_ValidateRequest(const XSdPs *InstancePtr,
+		const XSdPs_Request *ReqPtr);
+static s32 XSdPs_SetupIoVecDescTbl(XSdPs *InstancePtr,
+		const XSdPs_Request *ReqPtr);
+static s32 XSdPs_StartRequest(XSdPs *InstancePtr, XSdPs_Request *ReqPtr);
+static void XSdPs_CompleteRequest(XSdPs *InstancePtr, s32 Status);
+static void XSdPs_StartNextRequest(XSdPs *InstancePtr);
+
+/*****************************************************************************/
+/**
+* @brief
+* This function queues a read or write request. The request is started
+* right away if the controller is idle, otherwise it is started when the
+* requests queued before it have completed.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	ReqPtr is a pointer to the request. The request and its
+* 		buffer segments must stay valid until its handler is called.
+*
+* @return
+* 		- XST_SUCCESS if the request is queued
+* 		- XST_INVALID_PARAM if the request cannot be described by one
+* 		ADMA2 descriptor table or its length does not match BlkCnt
+* 		- XST_DEVICE_BUSY if the queue is full or a polled transfer is
+* 		in progress
+* 		- XST_FAILURE if the request could not be started
+*
+* @note		In interrupt mode, this API must be called with the SD
+* 		interrupt disabled.
+*
+******************************************************************************/
+s32 XSdPs_SubmitRequest(XSdPs *InstancePtr, XSdPs_Request *ReqPtr)
+{
+	s32 Status;
+	u8 Tail;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(ReqPtr != NULL);
+
+	Status = XSdPs_ValidateRequest(InstancePtr, ReqPtr);
+	if (Status != XST_SUCCESS) {
+		goto RETURN_PATH;
+	}
+
+	if ((InstancePtr->ReqCount >= XSDPS_REQ_QUEUE_DEPTH) ||
+		((InstancePtr->ReqCount == 0U) && (InstancePtr->IsBusy == TRUE))) {
+		Status = XST_DEVICE_BUSY;
+		goto RETURN_PATH;
+	}
+
+	ReqPtr->Status = XST_DEVICE_BUSY;
+	Tail = (u8)((InstancePtr->ReqHead + InstancePtr->ReqCount) %
+			XSDPS_REQ_QUEUE_DEPTH);
+	InstancePtr->ReqQueue[Tail] = ReqPtr;
+	InstancePtr->ReqCount++;
+
+	Status = XST_SUCCESS;
+	if (InstancePtr->ReqCount == 1U) {
+		Status = XSdPs_StartRequest(InstancePtr, ReqPtr);
+		if (Status != XST_SUCCESS) {
+			/* Drop the request, the caller gets the error instead */
+			InstancePtr->ReqQueue[InstancePtr->ReqHead] = NULL;
+			InstancePtr->ReqCount = 0U;
+			Status = XST_FAILURE;
+		}
+	}
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function checks the request in flight. If it has completed, its
+* handler is called and the next queued request is started.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+*
+* @return
+* 		- XST_SUCCESS if there are no requests left in the queue
+* 		- XST_DEVICE_BUSY if requests are still queued
+*
+******************************************************************************/
+s32 XSdPs_PollRequests(XSdPs *InstancePtr)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (InstancePtr->ReqCount == 0U) {
+		Status = XST_SUCCESS;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_CheckTransferComplete(InstancePtr);
+	if (Status == XST_DEVICE_BUSY) {
+		goto RETURN_PATH;
+	}
+
+	if (Status != XST_SUCCESS) {
+		/* Get the CMD and DAT lines back to a known state */
+		(void)XSdPs_Reset(InstancePtr, XSDPS_SWRST_CMD_LINE_MASK);
+		(void)XSdPs_Reset(InstancePtr, XSDPS_SWRST_DAT_LINE_MASK);
+		InstancePtr->IsBusy = FALSE;
+		Status = XST_FAILURE;
+	}
+
+	XSdPs_CompleteRequest(InstancePtr, Status);
+	XSdPs_StartNextRequest(InstancePtr);
+
+	if (InstancePtr->ReqCount == 0U) {
+		Status = XST_SUCCESS;
+	} else {
+		Status = XST_DEVICE_BUSY;
+	}
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function enables or disables the interrupt signals used to retire
+* queued requests. When enabled, the transfer complete and error interrupts
+* are signalled while requests are queued and XSdPs_RequestIntrHandler()
+* must be connected to the SD interrupt.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	Enable is TRUE to signal interrupts and FALSE to poll.
+*
+* @return	None
+*
+******************************************************************************/
+void XSdPs_SetRequestIntr(XSdPs *InstancePtr, u8 Enable)
+{
+	u16 SigMask = 0U;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	InstancePtr->ReqIntrEn = Enable;
+	if ((Enable == TRUE) && (InstancePtr->ReqCount != 0U)) {
+		SigMask = (u16)XSDPS_REQ_INTR_MASK;
+	}
+
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_NORM_INTR_SIG_EN_OFFSET, SigMask);
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_ERR_INTR_SIG_EN_OFFSET,
+			(SigMask != 0U) ? (u16)XSDPS_ERROR_INTR_ALL_MASK : 0U);
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function is the SD interrupt handler for queued requests.
+*
+* @param	CallBackRef is a pointer to the XSdPs instance.
+*
+* @return	None
+*
+******************************************************************************/
+void XSdPs_RequestIntrHandler(void *CallBackRef)
+{
+	XSdPs *InstancePtr = (XSdPs *)CallBackRef;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	(void)XSdPs_PollRequests(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function checks that a request can be described by one ADMA2
+* descriptor table and that its segments add up to BlkCnt blocks.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	ReqPtr is a pointer to the request.
+*
+* @return
+* 		- XST_SUCCESS if the request is valid
+* 		- XST_INVALID_PARAM otherwise
+*
+******************************************************************************/
+static s32 XSdPs_ValidateRequest(const XSdPs *InstancePtr,
+		const XSdPs_Request *ReqPtr)
+{
+	s32 Status = XST_INVALID_PARAM;
+	u32 BlkSize = InstancePtr->BlkSize;
+	u32 TotalLen = 0U;
+	u32 DescLines = 0U;
+	u32 Index;
+
+	if ((ReqPtr->IoVec == NULL) || (ReqPtr->IoVecCnt == 0U) ||
+		(ReqPtr->BlkCnt == 0U) ||
+		(ReqPtr->BlkCnt > XSDPS_CMD23_BLKCNT_MASK) || (BlkSize == 0U)) {
+		goto RETURN_PATH;
+	}
+
+	for (Index = 0U; Index < ReqPtr->IoVecCnt; Index++) {
+		if ((ReqPtr->IoVec[Index].Buff == NULL) ||
+			(ReqPtr->IoVec[Index].Len == 0U) ||
+			((ReqPtr->IoVec[Index].Len % BlkSize) != 0U)) {
+			goto RETURN_PATH;
+		}
+		if ((InstancePtr->HC_Version != XSDPS_HC_SPEC_V3) &&
+			((u64)(UINTPTR)ReqPtr->IoVec[Index].Buff >= ADDRESS_BEYOND_32BIT)) {
+			goto RETURN_PATH;
+		}
+		DescLines += (ReqPtr->IoVec[Index].Len + XSDPS_DESC_MAX_LENGTH - 1U) /
+				XSDPS_DESC_MAX_LENGTH;
+		TotalLen += ReqPtr->IoVec[Index].Len;
+	}
+
+	if ((DescLines > XSDPS_ADMA2_DESC_NUM) ||
+		(TotalLen != (ReqPtr->BlkCnt * BlkSize))) {
+		goto RETURN_PATH;
+	}
+
+	Status = XST_SUCCESS;
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function builds the ADMA2 descriptor table from the buffer segments
+* of a request and does the cache maintenance of the segments.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	ReqPtr is a pointer to the validated request.
+*
+* @return
+* 		- XST_SUCCESS if the table is built
+*
+******************************************************************************/
+static s32 XSdPs_SetupIoVecDescTbl(XSdPs *InstancePtr,
+		const XSdPs_Request *ReqPtr)
+{
+	u32 DescNum = 0U;
+	u32 Index;
+	u32 Offset;
+	u32 Len;
+	UINTPTR Addr;
+
+	for (Index = 0U; Index < ReqPtr->IoVecCnt; Index++) {
+		Addr = (UINTPTR)ReqPtr->IoVec[Index].Buff;
+		Len = ReqPtr->IoVec[Index].Len;
+
+		if (InstancePtr->Config.IsCacheCoherent == 0U) {
+			if (ReqPtr->IsWrite == TRUE) {
+				Xil_DCacheFlushRange((INTPTR)Addr, (INTPTR)Len);
+			} else {
+				Xil_DCacheInvalidateRange((INTPTR)Addr, (INTPTR)Len);
+			}
+		}
+
+		for (Offset = 0U; Offset < Len; Offset += XSDPS_DESC_MAX_LENGTH) {
+			if (InstancePtr->HC_Version == XSDPS_HC_SPEC_V3) {
+				InstancePtr->Adma2_DescrTbl64[DescNum].Address =
+						(u64)(Addr + Offset);
+				InstancePtr->Adma2_DescrTbl64[DescNum].Attribute =
+						XSDPS_DESC_TRAN | XSDPS_DESC_VALID;
+				/* Length 0 stands for XSDPS_DESC_MAX_LENGTH bytes */
+				InstancePtr->Adma2_DescrTbl64[DescNum].Length =
+						(u16)((Len - Offset) & 0xFFFFU);
+				if ((Len - Offset) >= XSDPS_DESC_MAX_LENGTH) {
+					InstancePtr->Adma2_DescrTbl64[DescNum].Length = 0U;
+				}
+			} else {
+				InstancePtr->Adma2_DescrTbl32[DescNum].Address =
+						(u32)(Addr + Offset);
+				InstancePtr->Adma2_DescrTbl32[DescNum].Attribute =
+						XSDPS_DESC_TRAN | XSDPS_DESC_VALID;
+				InstancePtr->Adma2_DescrTbl32[DescNum].Length =
+						(u16)((Len - Offset) & 0xFFFFU);
+				if ((Len - Offset) >= XSDPS_DESC_MAX_LENGTH) {
+					InstancePtr->Adma2_DescrTbl32[DescNum].Length = 0U;
+				}
+			}
+			DescNum++;
+		}
+	}
+
+	if (InstancePtr->HC_Version == XSDPS_HC_SPEC_V3) {
+		InstancePtr->Adma2_DescrTbl64[DescNum - 1U].Attribute |=
+				XSDPS_DESC_END;
+#if defined(__aarch64__) || defined(__arch64__)
+		XSdPs_WriteReg(InstancePtr->Config.BaseAddress,
+				XSDPS_ADMA_SAR_EXT_OFFSET,
+				(u32)((UINTPTR)(InstancePtr->Adma2_DescrTbl64) >> 32U));
+#endif
+		XSdPs_WriteReg(InstancePtr->Config.BaseAddress,
+				XSDPS_ADMA_SAR_OFFSET,
+				(u32)((UINTPTR)&(InstancePtr->Adma2_DescrTbl64[0]) &
+				~(u32)0x0U));
+		if (InstancePtr->Config.IsCacheCoherent == 0U) {
+			Xil_DCacheFlushRange((INTPTR)&(InstancePtr->Adma2_DescrTbl64[0]),
+				(INTPTR)sizeof(XSdPs_Adma2Descriptor64) * (INTPTR)DescNum);
+		}
+	} else {
+		InstancePtr->Adma2_DescrTbl32[DescNum - 1U].Attribute |=
+				XSDPS_DESC_END;
+		XSdPs_WriteReg(InstancePtr->Config.BaseAddress,
+				XSDPS_ADMA_SAR_OFFSET,
+				(u32)((UINTPTR)&(InstancePtr->Adma2_DescrTbl32[0]) &
+				~(u32)0x0U));
+		if (InstancePtr->Config.IsCacheCoherent == 0U) {
+			Xil_DCacheFlushRange((INTPTR)&(InstancePtr->Adma2_DescrTbl32[0]),
+				(INTPTR)sizeof(XSdPs_Adma2Descriptor32) * (INTPTR)DescNum);
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function starts a request on the controller without waiting for it
+* to complete. Multi block transfers to MMC and eMMC devices announce the
+* block count with CMD23 so that the device does not need a stop command,
+* SD cards keep using Auto CMD12.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	ReqPtr is a pointer to the validated request.
+*
+* @return
+* 		- XST_SUCCESS if the request is started
+* 		- XST_FAILURE if failure
+*
+******************************************************************************/
+static s32 XSdPs_StartRequest(XSdPs *InstancePtr, XSdPs_Request *ReqPtr)
+{
+	s32 Status;
+	u32 Cmd;
+	u16 TransferMode;
+	u8 UseCmd23;
+
+#if defined  (XCLOCKING)
+	Xil_ClockEnable(InstancePtr->Config.RefClk);
+#endif
+
+	Status = XSdPs_SetupTransfer(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_BLK_SIZE_OFFSET,
+			(u16)(InstancePtr->BlkSize & XSDPS_BLK_SIZE_MASK));
+
+	Status = XSdPs_SetupIoVecDescTbl(InstancePtr, ReqPtr);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	UseCmd23 = (u8)(((ReqPtr->BlkCnt > 1U) &&
+			(InstancePtr->CardType != XSDPS_CARD_SD)) ? TRUE : FALSE);
+
+	TransferMode = XSDPS_TM_BLK_CNT_EN_MASK | XSDPS_TM_DMA_EN_MASK;
+	if (ReqPtr->IsWrite == FALSE) {
+		TransferMode |= XSDPS_TM_DAT_DIR_SEL_MASK;
+	}
+	if (ReqPtr->BlkCnt > 1U) {
+		TransferMode |= XSDPS_TM_MUL_SIN_BLK_SEL_MASK;
+		if (UseCmd23 == FALSE) {
+			TransferMode |= XSDPS_TM_AUTO_CMD12_EN_MASK;
+		}
+	}
+
+	if (UseCmd23 == TRUE) {
+		InstancePtr->TransferMode = 0U;
+		Status = XSdPs_CmdTransfer(InstancePtr, CMD23,
+				ReqPtr->BlkCnt & XSDPS_CMD23_BLKCNT_MASK, 0U);
+		if (Status != XST_SUCCESS) {
+			Status = XST_FAILURE;
+			goto RETURN_PATH;
+		}
+	}
+
+	if (ReqPtr->IsWrite == TRUE) {
+		Cmd = (ReqPtr->BlkCnt == 1U) ? CMD24 : CMD25;
+	} else {
+		Cmd = (ReqPtr->BlkCnt == 1U) ? CMD17 : CMD18;
+	}
+
+	InstancePtr->TransferMode = TransferMode;
+	Status = XSdPs_CmdTransfer(InstancePtr, Cmd, ReqPtr->Arg, ReqPtr->BlkCnt);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	InstancePtr->IsBusy = TRUE;
+
+	if (InstancePtr->ReqIntrEn == TRUE) {
+		XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+				XSDPS_NORM_INTR_SIG_EN_OFFSET,
+				(u16)XSDPS_REQ_INTR_MASK);
+		XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+				XSDPS_ERR_INTR_SIG_EN_OFFSET,
+				(u16)XSDPS_ERROR_INTR_ALL_MASK);
+	}
+
+RETURN_PATH:
+#if defined  (XCLOCKING)
+	if (Status != XST_SUCCESS) {
+		Xil_ClockDisable(InstancePtr->Config.RefClk);
+	}
+#endif
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function removes the head request from the queue and calls its
+* handler.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	Status is the completion status of the request.
+*
+* @return	None
+*
+******************************************************************************/
+static void XSdPs_CompleteRequest(XSdPs *InstancePtr, s32 Status)
+{
+	XSdPs_Request *ReqPtr = InstancePtr->ReqQueue[InstancePtr->ReqHead];
+	u32 Index;
+
+	InstancePtr->ReqQueue[InstancePtr->ReqHead] = NULL;
+	InstancePtr->ReqHead = (u8)((InstancePtr->ReqHead + 1U) %
+			XSDPS_REQ_QUEUE_DEPTH);
+	InstancePtr->ReqCount--;
+
+#if defined  (XCLOCKING)
+	Xil_ClockDisable(InstancePtr->Config.RefClk);
+#endif
+
+	if ((ReqPtr->IsWrite == FALSE) &&
+		(InstancePtr->Config.IsCacheCoherent == 0U)) {
+		for (Index = 0U; Index < ReqPtr->IoVecCnt; Index++) {
+			Xil_DCacheInvalidateRange((INTPTR)ReqPtr->IoVec[Index].Buff,
+					(INTPTR)ReqPtr->IoVec[Index].Len);
+		}
+	}
+
+	ReqPtr->Status = Status;
+	if (ReqPtr->Handler != NULL) {
+		ReqPtr->Handler(ReqPtr->CallBackRef, Status);
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function starts the next queued request. Requests which fail to
+* start are completed with XST_FAILURE.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+*
+* @return	None
+*
+******************************************************************************/
+static void XSdPs_StartNextRequest(XSdPs *InstancePtr)
+{
+	s32 Status;
+
+	while (InstancePtr->ReqCount != 0U) {
+		Status = XSdPs_StartRequest(InstancePtr,
+				InstancePtr->ReqQueue[InstancePtr->ReqHead]);
+		if (Status == XST_SUCCESS) {
+			break;
+		}
+#if defined  (XCLOCKING)
+		/* Balance the clock disable done on completion */
+		Xil_ClockEnable(InstancePtr->Config.RefClk);
+#endif
+		XSdPs_CompleteRequest(InstancePtr, XST_FAILURE);
+	}
+
+	if ((InstancePtr->ReqCount == 0U) && (InstancePtr->ReqIntrEn == TRUE)) {
+		XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+				XSDPS_NORM_INTR_SIG_EN_OFFSET, 0U);
+		XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+				XSDPS_ERR_INTR_SIG_EN_OFFSET, 0U);
+	}
+}
+/** @} */
@@ -16,6 +16,10 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 1.0	tk	01/30/2019	First release
+* 1.6	agt	10/18/2026	Probe only device 0 below downstream ports,
+*				allocate BARs largest first, cache the
+*				enumerated topology and add
+*				XDmaPcie_ReEnumerateFabric().
 * </pre>
 *
 *****************************************************************************/
@@ -28,12 +32,27 @@
 
 /***************************** Type Definitions *****************************/
 
+/*
+ * A memory BAR sized by XDmaPcie_AllocBarSpace().
+ */
+typedef struct {
+#if defined(__aarch64__) || defined(__arch64__)
+	u64 Size;
+#else
+	u32 Size;
+#endif
+	u8 BarNo;
+	u8 MemAs;
+} XDmaPcie_BarInfo;
+
 /****************** Macros (Inline Functions) Definitions *******************/
 
 /*************************** Variable Definitions ***************************/
 
 /*************************** Function Prototypes ****************************/
 
+static void XDmaPcie_FetchDevicesInBus(XDmaPcie *InstancePtr, u32 BusNum,
+		u8 OnlyDev0);
 
 
 /****************************************************************************/
@@ -79,6 +98,12 @@ int XDmaPcie_CfgInitialize(XDmaPcie *InstancePtr, XDmaPcie_Config *CfgPtr,
 	if (InstancePtr->Config.Ecam == InstancePtr->Config.NpMemBaseAddr)
 		InstancePtr->Config.NpMemBaseAddr += XDMAPCIE_ECAM_MEMSIZE;
 
+	/* Enumeration restarts allocation from here */
+	InstancePtr->NpMemStartAddr = InstancePtr->Config.NpMemBaseAddr;
+#if defined(__aarch64__) || defined(__arch64__)
+	InstancePtr->PMemStartAddr = InstancePtr->Config.PMemBaseAddr;
+#endif
+
 	/* Disable all interrupts */
 	XDmaPcie_DisableInterrupts(InstancePtr, XDMAPCIE_IM_DISABLE_ALL_MASK);
 
@@ -112,9 +137,9 @@ static u8 XdmaPcie_IsValidAddr(u64 Addr)
 * @param   InstancePtr pointer to XDmaPcie Instance Pointer
 * @param   mem_type type of bar memory. address mem or IO.
 * @param   mem_as bar memory tpye 32 or 64 bit
-* @param   size	u64 size to increase
+* @param   size	u64 size to increase, a power of 2
 *
-* @return  bar address
+* @return  bar address, aligned to size
 *
 *******************************************************************************/
 static u64 XDmaPcie_ReserveBarMem(XDmaPcie *InstancePtr,
@@ -124,15 +149,15 @@ static u64 XDmaPcie_ReserveBarMem(XDmaPcie *InstancePtr,
 
 	if ((MemBarArdSize == XDMAPCIE_BAR_MEM_TYPE_64) &&
 	    (XdmaPcie_IsValidAddr(InstancePtr->Config.PMemBaseAddr) == TRUE)) {
-		Ret = InstancePtr->Config.PMemBaseAddr;
-		InstancePtr->Config.PMemBaseAddr = InstancePtr->Config.PMemBaseAddr
-							+ Size;
+		Ret = (InstancePtr->Config.PMemBaseAddr + Size - 1) &
+			~(Size - 1);
+		InstancePtr->Config.PMemBaseAddr = Ret + Size;
 		Xil_AssertNonvoid(InstancePtr->Config.PMemBaseAddr <=
 				InstancePtr->Config.PMemMaxAddr);
 	} else {
-		Ret = InstancePtr->Config.NpMemBaseAddr;
-		InstancePtr->Config.NpMemBaseAddr = InstancePtr->Config.NpMemBaseAddr
-							+ Size;
+		Ret = ((u64)InstancePtr->Config.NpMemBaseAddr + Size - 1) &
+			~(Size - 1);
+		InstancePtr->Config.NpMemBaseAddr = (u32)(Ret + Size);
 		Xil_AssertNonvoid(InstancePtr->Config.NpMemBaseAddr <=
 				InstancePtr->Config.NpMemMaxAddr);
 	}
@@ -144,9 +169,8 @@ static u32 XDmaPcie_ReserveBarMem(XDmaPcie *InstancePtr, u32 Size)
 {
 	u32 Ret = 0;
 
-	Ret = InstancePtr->Config.NpMemBaseAddr;
-	InstancePtr->Config.NpMemBaseAddr = InstancePtr->Config.NpMemBaseAddr
-						+ Size;
+	Ret = (InstancePtr->Config.NpMemBaseAddr + Size - 1) & ~(Size - 1);
+	InstancePtr->Config.NpMemBaseAddr = Ret + Size;
 	Xil_AssertNonvoid(InstancePtr->Config.NpMemBaseAddr <=
 			InstancePtr->Config.NpMemMaxAddr);
 
@@ -154,21 +178,6 @@ static u32 XDmaPcie_ReserveBarMem(XDmaPcie *InstancePtr, u32 Size)
 }
 #endif
 
-static int XDmaPcie_PositionRightmostSetbit(u64 Size)
-{
-	int Position = 0;
-	int Bit = 1;
-
-	/* ignore 4 bits */
-	Size = Size & (~(0xf));
-
-	while (!(Size & Bit)) {
-		Bit = Bit << 1;
-		Position++;
-	}
-
-	return Position;
-}
 /******************************************************************************/
 /**
 * This function increments to next 1Mb page starting position of
@@ -186,7 +195,9 @@ static void XDmaPcie_IncreamentNpMem(XDmaPcie *InstancePtr)
 
 /******************************************************************************/
 /**
-* This function Composes configuration space location
+* This function sizes the memory BARs of a function and assigns them
+* addresses. The BARs are assigned largest first so that each one is
+* naturally aligned with no padding between them.
 *
 * @param   InstancePtr pointer to XDmaPcie Instance Pointer
 * @param   headerType u32 type0 or type1 header
@@ -203,17 +214,23 @@ static int XDmaPcie_AllocBarSpace(XDmaPcie *InstancePtr, u32 Headertype, u8 Bus,
 {
 	u32 Data = DATA_MASK_32;
 	u32 Location = 0;
-	u32 Size = 0, TestWrite;
+	u32 Size = 0;
+	XDmaPcie_BarInfo Bars[XDMAPCIE_CFG_MAX_NUM_OF_BARS];
+	XDmaPcie_BarInfo Bar;
 #if defined(__aarch64__) || defined(__arch64__)
 	u64 BarAddr;
-	u32 Size_1 = 0, *PPtr;
+	u64 SizeMask;
+	u32 Size_1 = 0;
 	u32 Location_1 = 0;
-	u8 MemAs;
 #else
 	u32 BarAddr;
+	u32 SizeMask;
 #endif
 	u32 Tmp;
 	u8 BarNo;
+	u8 NumBars = 0;
+	u8 Idx;
+	u8 Pos;
 
 	u8 MaxBars = 0;
 
@@ -254,11 +271,14 @@ static int XDmaPcie_AllocBarSpace(XDmaPcie *InstancePtr, u32 Headertype, u8 Bus,
 			continue;
 		}
 
+		/* ignore 4 bits */
+		SizeMask = Size & (~(0xf));
+		Bars[NumBars].BarNo = BarNo;
+		Bars[NumBars].MemAs = Size & XDMAPCIE_CFG_BAR_MEM_AS_MASK;
+
 		/* check for 32 bit AS or 64 bit AS */
-		if ((Size & XDMAPCIE_CFG_BAR_MEM_AS_MASK) == XDMAPCIE_BAR_MEM_TYPE_64) {
+		if (Bars[NumBars].MemAs == XDMAPCIE_BAR_MEM_TYPE_64) {
 #if defined(__aarch64__) || defined(__arch64__)
-			/* 64 bit AS is required */
-			MemAs = XDMAPCIE_BAR_MEM_TYPE_64;
 			/* Compose function configuration space location */
 			Location_1 = XDmaPcie_ComposeExternalConfigAddress(
 				Bus, Device, Function,
@@ -273,86 +293,65 @@ static int XDmaPcie_AllocBarSpace(XDmaPcie *InstancePtr, u32 Headertype, u8 Bus,
 						Location_1);
 
 			/* Merge two bars for size */
-			PPtr = (u32 *)&BarAddr;
-			*PPtr = Size;
-			*(PPtr + 1) = Size_1;
-
-			TestWrite = XDmaPcie_PositionRightmostSetbit(BarAddr);
-			/* actual bar size is 2 << TestWrite */
-			BarAddr =
-				XDmaPcie_ReserveBarMem(InstancePtr, MemAs,
-						(2 << (TestWrite - 1)));
+			SizeMask |= ((u64)Size_1 << 32);
+#endif
+			/* no need to probe next bar if present BAR requires
+			 * 64 bit AS
+			 */
+			BarNo = BarNo + 1;
+		}
 
-			Tmp = (u32)BarAddr;
+		/* actual bar size is the lowest writable address bit */
+		Bars[NumBars].Size = SizeMask & (~SizeMask + 1);
+		NumBars++;
+	}
 
-			/* Write actual bar address here */
-			XDmaPcie_WriteReg((InstancePtr->Config.Ecam), Location,
-					  Tmp);
+	/* Sort largest first */
+	for (Idx = 1; Idx < NumBars; Idx++) {
+		Bar = Bars[Idx];
+		for (Pos = Idx; (Pos > 0) && (Bars[Pos - 1].Size < Bar.Size);
+		     Pos--) {
+			Bars[Pos] = Bars[Pos - 1];
+		}
+		Bars[Pos] = Bar;
+	}
 
-			Tmp = (u32)(BarAddr >> 32);
+	for (Idx = 0; Idx < NumBars; Idx++) {
+		BarNo = Bars[Idx].BarNo;
+		Location = XDmaPcie_ComposeExternalConfigAddress(
+			Bus, Device, Function,
+			XDMAPCIE_CFG_BAR_BASE_OFFSET + BarNo);
 
-			/* Write actual bar address here */
-			XDmaPcie_WriteReg((InstancePtr->Config.Ecam),
-						Location_1, Tmp);
-			XDmaPcie_Dbg(
-				"bus: %d, device: %d, function: %d: BAR %d, "
-				"ADDR: 0x%p size : %dK\r\n",
-				Bus, Device, Function, BarNo, BarAddr,
-				((2 << (TestWrite - 1)) / 1024));
+#if defined(__aarch64__) || defined(__arch64__)
+		BarAddr = XDmaPcie_ReserveBarMem(InstancePtr, Bars[Idx].MemAs,
+						 Bars[Idx].Size);
 #else
-			TestWrite = XDmaPcie_PositionRightmostSetbit(Size);
-
-			/* actual bar size is 2 << TestWrite */
-			BarAddr =
-				XDmaPcie_ReserveBarMem(InstancePtr,
-						(2 << (TestWrite - 1)));
-
-			Tmp = (u32)BarAddr;
-
-			/* Write actual bar address here */
-			XDmaPcie_WriteReg((InstancePtr->Config.Ecam), Location,
-					Tmp);
-			XDmaPcie_Dbg(
-				"bus: %d, device: %d, function: %d: BAR %d, "
-				"ADDR: 0x%p size : %dK\r\n",
-				Bus, Device, Function, BarNo, BarAddr,
-				((2 << (TestWrite - 1)) / 1024));
-
+		BarAddr = XDmaPcie_ReserveBarMem(InstancePtr, Bars[Idx].Size);
 #endif
 
-		} else {
-			TestWrite = XDmaPcie_PositionRightmostSetbit(Size);
+		Tmp = (u32)BarAddr;
 
-#if defined(__aarch64__) || defined(__arch64__)
-			/* 32 bit AS is required */
-			MemAs = XDMAPCIE_BAR_MEM_TYPE_32;
+		/* Write actual bar address here */
+		XDmaPcie_WriteReg((InstancePtr->Config.Ecam), Location, Tmp);
 
-			/* actual bar size is 2 << TestWrite */
-			BarAddr =
-				XDmaPcie_ReserveBarMem(InstancePtr, MemAs,
-						(2 << (TestWrite - 1)));
-#else
-			/* actual bar size is 2 << TestWrite */
-			BarAddr =
-				XDmaPcie_ReserveBarMem(InstancePtr,
-						(2 << (TestWrite - 1)));
-#endif
+#if defined(__aarch64__) || defined(__arch64__)
+		if (Bars[Idx].MemAs == XDMAPCIE_BAR_MEM_TYPE_64) {
+			Location_1 = XDmaPcie_ComposeExternalConfigAddress(
+				Bus, Device, Function,
+				XDMAPCIE_CFG_BAR_BASE_OFFSET + (BarNo + 1));
 
-			Tmp = (u32)BarAddr;
+			Tmp = (u32)(BarAddr >> 32);
 
 			/* Write actual bar address here */
-			XDmaPcie_WriteReg((InstancePtr->Config.Ecam), Location,
-					Tmp);
-			XDmaPcie_Dbg(
-				"bus: %d, device: %d, function: %d: BAR %d, "
-				"ADDR: 0x%p size : %dK\r\n",
-				Bus, Device, Function, BarNo, BarAddr,
-				((2 << (TestWrite - 1)) / 1024));
+			XDmaPcie_WriteReg((InstancePtr->Config.Ecam),
+						Location_1, Tmp);
 		}
-		/* no need to probe next bar if present BAR requires 64 bit AS
-		 */
-		if ((Size & XDMAPCIE_CFG_BAR_MEM_AS_MASK) == XDMAPCIE_BAR_MEM_TYPE_64)
-			BarNo = BarNo + 1;
+#endif
+		XDmaPcie_Dbg(
+			"bus: %d, device: %d, function: %d: BAR %d, "
+			"ADDR: 0x%p size : %dK\r\n",
+			Bus, Device, Function, BarNo, BarAddr,
+			(u32)(Bars[Idx].Size / 1024));
 	}
 
 	return XST_SUCCESS;
@@ -374,6 +373,76 @@ static void XDmaPcie_IncrementPMem(XDmaPcie *InstancePtr)
 	InstancePtr->Config.PMemBaseAddr <<= MB_SHIFT;
 }
 #endif
+/******************************************************************************/
+/**
+* This function adds a function found by the enumeration to the topology
+* cache.
+*
+* @param   InstancePtr pointer to XDmaPcie Instance Pointer
+* @param   Bus
+* @param   Device
+* @param   Function
+* @param   Id is the Vendor ID and Device ID register of the function
+*
+* @return  index of the cache entry, -1 if the cache is full
+*
+*******************************************************************************/
+static int XDmaPcie_TopoAdd(XDmaPcie *InstancePtr, u8 Bus, u8 Device,
+		u8 Function, u32 Id)
+{
+	XDmaPcie_TopoFunc *Func;
+
+	if (InstancePtr->TopoCount >= XDMAPCIE_TOPO_MAX_FUNCS) {
+		InstancePtr->TopoValid = FALSE;
+		return -1;
+	}
+
+	Func = &InstancePtr->Topo[InstancePtr->TopoCount];
+	Func->Id = Id;
+	Func->Bus = Bus;
+	Func->Device = Device;
+	Func->Function = Function;
+	Func->Flags = 0;
+	Func->SecBus = 0;
+	Func->SubBus = 0;
+
+	return (int)InstancePtr->TopoCount++;
+}
+
+/******************************************************************************/
+/**
+* This function tells whether a bridge is a PCI Express Root Port or Switch
+* Downstream Port. The link below such a port leads to a single device, so
+* only device 0 has to be probed on its secondary bus.
+*
+* @param   InstancePtr pointer to XDmaPcie Instance Pointer
+* @param   Bus
+* @param   Device
+* @param   Function
+*
+* @return  TRUE for a Root Port or Downstream Port, FALSE otherwise
+*
+*******************************************************************************/
+static u8 XDmaPcie_IsDownstreamPort(XDmaPcie *InstancePtr, u8 Bus, u8 Device,
+		u8 Function)
+{
+	u64 CapAddr;
+	u32 PortType;
+
+	CapAddr = XDmaPcie_GetCapability(InstancePtr, Bus, Device, Function,
+			XDMAPCIE_CAP_ID_PCIE);
+	if (CapAddr == CAP_NOT_PRESENT)
+		return FALSE;
+
+	PortType = (XDmaPcie_ReadReg((UINTPTR)CapAddr, 0) &
+		    XDMAPCIE_CAP_PCIE_TYPE_MASK) >> XDMAPCIE_CAP_PCIE_TYPE_SHIFT;
+	if ((PortType == XDMAPCIE_CAP_PCIE_TYPE_ROOT_PORT) ||
+	    (PortType == XDMAPCIE_CAP_PCIE_TYPE_DOWNSTREAM))
+		return TRUE;
+
+	return FALSE;
+}
+
 /******************************************************************************/
 /**
 * This function starts enumeration of PCIe Fabric on the system.
@@ -383,14 +452,22 @@ static void XDmaPcie_IncrementPMem(XDmaPcie *InstancePtr)
 *
 * @param   	InstancePtr pointer to XDmaPcie Instance Pointer
 * @param   	bus_num	to scans for connected bridges/endpoints on it.
+* @param   	OnlyDev0 is TRUE if the bus is below a downstream port, so that
+*		only device 0 can be present on it.
 *
 * @return  	none
 *
 *******************************************************************************/
-static void XDmaPcie_FetchDevicesInBus(XDmaPcie *InstancePtr, u32 BusNum)
+static void XDmaPcie_FetchDevicesInBus(XDmaPcie *InstancePtr, u32 BusNum,
+		u8 OnlyDev0)
 {
 	u32 ConfigData;
-	static u32 LastBusNum;
+	u32 PCIeIdReg;
+	u32 MaxDevNum;
+	u32 SecBusNum;
+	u32 TopoCount;
+	int TopoIdx;
+	u8 DownstreamPort;
 
 	u16 PCIeVendorID;
 	u16 PCIeDeviceID;
@@ -414,8 +491,9 @@ static void XDmaPcie_FetchDevicesInBus(XDmaPcie *InstancePtr, u32 BusNum)
 		return;
 	}
 
-	for (u32 PCIeDevNum = 0; PCIeDevNum < XDMAPCIE_CFG_MAX_NUM_OF_DEV;
-	     PCIeDevNum++) {
+	MaxDevNum = (OnlyDev0 == TRUE) ? 1 : XDMAPCIE_CFG_MAX_NUM_OF_DEV;
+
+	for (u32 PCIeDevNum = 0; PCIeDevNum < MaxDevNum; PCIeDevNum++) {
 		for (u32 PCIeFunNum = 0; PCIeFunNum < XDMAPCIE_CFG_MAX_NUM_OF_FUN;
 		     PCIeFunNum++) {
 
@@ -424,6 +502,7 @@ static void XDmaPcie_FetchDevicesInBus(XDmaPcie *InstancePtr, u32 BusNum)
 				InstancePtr, BusNum, PCIeDevNum, PCIeFunNum,
 				XDMAPCIE_CFG_ID_REG, &ConfigData);
 
+			PCIeIdReg = ConfigData;
 			PCIeVendorID = (u16)(ConfigData & 0xFFFF);
 			PCIeDeviceID = (u16)((ConfigData >> 16) & 0xFFFF);
 
@@ -456,6 +535,10 @@ static void XDmaPcie_FetchDevicesInBus(XDmaPcie *InstancePtr, u32 BusNum)
 				PCIeMultiFun =
 					ConfigData & XDMAPCIE_CFG_MUL_FUN_DEV_MASK;
 
+				TopoIdx = XDmaPcie_TopoAdd(InstancePtr, BusNum,
+						PCIeDevNum, PCIeFunNum,
+						PCIeIdReg);
+
 				if (PCIeHeaderType == XDMAPCIE_CFG_HEADER_O_TYPE) {
 					/* This is an End Point */
 					XDmaPcie_Dbg("This is an End Point\r\n");
@@ -526,8 +609,9 @@ static void XDmaPcie_FetchDevicesInBus(XDmaPcie *InstancePtr, u32 BusNum)
 					Adr06 |= 0xFF; /* sub ordinate bus no 0xF
 						     */
 					Adr06 <<= TWO_HEX_NIBBLES;
-					Adr06 |= (++LastBusNum); /* secondary
+					Adr06 |= (++InstancePtr->LastBusNum); /* secondary
 							      bus no */
+					SecBusNum = InstancePtr->LastBusNum;
 					Adr06 <<= TWO_HEX_NIBBLES;
 					Adr06 |= BusNum; /* Primary bus no */
 					XDmaPcie_WriteRemoteConfigSpace(
@@ -566,8 +650,25 @@ static void XDmaPcie_FetchDevicesInBus(XDmaPcie *InstancePtr, u32 BusNum)
 #endif
 
 					/* Searches secondary bus devices. */
+					DownstreamPort = XDmaPcie_IsDownstreamPort(
+						InstancePtr, BusNum, PCIeDevNum,
+						PCIeFunNum);
+					TopoCount = InstancePtr->TopoCount;
 					XDmaPcie_FetchDevicesInBus(InstancePtr,
-							  LastBusNum);
+							  SecBusNum,
+							  DownstreamPort);
+
+					if (TopoIdx >= 0) {
+						InstancePtr->Topo[TopoIdx].Flags =
+							XDMAPCIE_TOPO_BRIDGE;
+						if (TopoCount == InstancePtr->TopoCount)
+							InstancePtr->Topo[TopoIdx].Flags |=
+								XDMAPCIE_TOPO_EMPTY;
+						InstancePtr->Topo[TopoIdx].SecBus =
+							(u8)SecBusNum;
+						InstancePtr->Topo[TopoIdx].SubBus =
+							(u8)InstancePtr->LastBusNum;
+					}
 
 					/*
 					 * update subordinate bus no
@@ -575,7 +676,7 @@ static void XDmaPcie_FetchDevicesInBus(XDmaPcie *InstancePtr, u32 BusNum)
 					 */
 					Adr06 &= (~(0xFF << FOUR_HEX_NIBBLES));
 					/* setting subordinate bus no */
-					Adr06 |= (LastBusNum
+					Adr06 |= (InstancePtr->LastBusNum
 						  << FOUR_HEX_NIBBLES);
 					XDmaPcie_WriteRemoteConfigSpace(
 						InstancePtr, BusNum,
@@ -669,7 +770,9 @@ static void XDmaPcie_FetchDevicesInBus(XDmaPcie *InstancePtr, u32 BusNum)
 
 /******************************************************************************/
 /**
-* This function starts PCIe enumeration.
+* This function starts PCIe enumeration. Bus numbers and memory are assigned
+* from the start again on every call, and the functions found are kept in
+* the topology cache of the instance.
 *
 * @param    InstancePtr pointer to XDmaPcie Instance Pointer
 *
@@ -678,7 +781,85 @@ static void XDmaPcie_FetchDevicesInBus(XDmaPcie *InstancePtr, u32 BusNum)
 *******************************************************************************/
 void XDmaPcie_EnumerateFabric(XDmaPcie *InstancePtr)
 {
-	XDmaPcie_FetchDevicesInBus(InstancePtr, 0);
+	InstancePtr->LastBusNum = 0;
+	InstancePtr->TopoCount = 0;
+	InstancePtr->TopoValid = TRUE;
+	InstancePtr->Config.NpMemBaseAddr = InstancePtr->NpMemStartAddr;
+#if defined(__aarch64__) || defined(__arch64__)
+	InstancePtr->Config.PMemBaseAddr = InstancePtr->PMemStartAddr;
+#endif
+
+	XDmaPcie_FetchDevicesInBus(InstancePtr, 0, FALSE);
+}
+
+/******************************************************************************/
+/**
+* This function enumerates the PCIe fabric again only if it changed since
+* the last enumeration, for example after a link retrain or hot reset.
+*
+* Every function in the topology cache is checked for the same Vendor ID and
+* Device ID and for still being enabled, and device 0 is probed below every
+* bridge which had nothing below it. If all checks pass nothing is written,
+* otherwise XDmaPcie_EnumerateFabric() is run.
+*
+* @param    InstancePtr pointer to XDmaPcie Instance Pointer
+* @param    ChangedPtr is set to TRUE if the fabric was enumerated again,
+*	    FALSE otherwise. May be NULL.
+*
+* @return 	XST_SUCCESS
+*
+*******************************************************************************/
+int XDmaPcie_ReEnumerateFabric(XDmaPcie *InstancePtr, u8 *ChangedPtr)
+{
+	XDmaPcie_TopoFunc *Func;
+	u32 ConfigData;
+	u32 Idx;
+	u8 Changed = FALSE;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if ((InstancePtr->TopoValid != TRUE) || (InstancePtr->TopoCount == 0))
+		Changed = TRUE;
+
+	for (Idx = 0; (Changed == FALSE) && (Idx < InstancePtr->TopoCount);
+	     Idx++) {
+		Func = &InstancePtr->Topo[Idx];
+
+		XDmaPcie_ReadRemoteConfigSpace(InstancePtr, Func->Bus,
+				Func->Device, Func->Function,
+				XDMAPCIE_CFG_ID_REG, &ConfigData);
+		if (ConfigData != Func->Id) {
+			Changed = TRUE;
+			break;
+		}
+
+		/* A reset function has lost its BARs and enables */
+		XDmaPcie_ReadRemoteConfigSpace(InstancePtr, Func->Bus,
+				Func->Device, Func->Function,
+				XDMAPCIE_CFG_CMD_STATUS_REG, &ConfigData);
+		if ((ConfigData & XDMAPCIE_CFG_CMD_MEM_EN) == 0) {
+			Changed = TRUE;
+			break;
+		}
+
+		if ((Func->Flags & XDMAPCIE_TOPO_EMPTY) != 0) {
+			XDmaPcie_ReadRemoteConfigSpace(InstancePtr,
+					Func->SecBus, 0, 0,
+					XDMAPCIE_CFG_ID_REG, &ConfigData);
+			if ((ConfigData & 0xFFFF) !=
+			    XDMAPCIE_CFG_FUN_NOT_IMP_MASK)
+				Changed = TRUE;
+		}
+	}
+
+	if (Changed == TRUE)
+		XDmaPcie_EnumerateFabric(InstancePtr);
+
+	if (ChangedPtr != NULL)
+		*ChangedPtr = Changed;
+
+	return XST_SUCCESS;
 }
 
 /****************************************************************************/
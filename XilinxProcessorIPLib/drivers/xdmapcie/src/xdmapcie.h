@@ -50,6 +50,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 1.0	tk	01/30/2019	First release
+* 1.6	agt	10/18/2026	Added enumeration topology cache and
+*				XDmaPcie_ReEnumerateFabric().
 * </pre>
 *
 *****************************************************************************/
@@ -90,6 +92,21 @@ extern "C" {
 #define XDMAPCIE_VSEC1		0x00 /**< First VSEC Register */
 #define XDMAPCIE_VSEC2		0x01 /**< Second VSEC Register */
 
+/*
+ * Number of functions kept in the topology cache filled by
+ * XDmaPcie_EnumerateFabric(). With more functions the cache is not used and
+ * XDmaPcie_ReEnumerateFabric() always enumerates the whole fabric.
+ */
+#ifndef XDMAPCIE_TOPO_MAX_FUNCS
+#define XDMAPCIE_TOPO_MAX_FUNCS	64
+#endif
+
+/*
+ * Topology cache entry flags.
+ */
+#define XDMAPCIE_TOPO_BRIDGE	0x01 /**< Function is a bridge */
+#define XDMAPCIE_TOPO_EMPTY	0x02 /**< No function below the bridge */
+
 /**************************** Type Definitions ******************************/
 
 /**
@@ -122,6 +139,19 @@ typedef  struct {
 
 } XDmaPcie_Config;
 
+/**
+ * A function found by XDmaPcie_EnumerateFabric().
+ */
+typedef struct {
+	u32 Id;			/**< Vendor ID and Device ID register */
+	u8 Bus;			/**< Bus number */
+	u8 Device;		/**< Device number */
+	u8 Function;		/**< Function number */
+	u8 Flags;		/**< XDMAPCIE_TOPO_* flags */
+	u8 SecBus;		/**< Secondary bus of a bridge */
+	u8 SubBus;		/**< Subordinate bus of a bridge */
+} XDmaPcie_TopoFunc;
+
 /**
  * The XDmaPcie driver instance data. The user is required to allocate a
  * variable of this type for every PCIe device in the system that will be
@@ -134,6 +164,17 @@ typedef struct {
 	u32 IsReady;			/**< Is IP been initialized and ready */
 	u32 MaxNumOfBuses;		/**< If this is RC IP, Max Number of
 					 * Buses */
+	u32 LastBusNum;			/**< Last bus number assigned by the
+					 * enumeration */
+#if defined(__aarch64__) || defined(__arch64__)
+	u64 PMemStartAddr;		/**< prefetchable memory start address */
+#endif
+	u32 NpMemStartAddr;		/**< non prefetchable memory start
+					 * address */
+	u32 TopoCount;			/**< Functions in Topo */
+	u8 TopoValid;			/**< Topo holds the whole fabric */
+	XDmaPcie_TopoFunc Topo[XDMAPCIE_TOPO_MAX_FUNCS]; /**< Functions found
+					 * by the last enumeration */
 
 } XDmaPcie;
 
@@ -250,6 +291,7 @@ void XDmaPcie_WriteRemoteConfigSpace(XDmaPcie *InstancePtr, u8 Bus, u8 Device,
 u32 XDmaPcie_ComposeExternalConfigAddress(u8 Bus, u8 Device, u8 Function,
 								 u16 Offset);
 void XDmaPcie_EnumerateFabric(XDmaPcie *XdmaPciePtr);
+int XDmaPcie_ReEnumerateFabric(XDmaPcie *InstancePtr, u8 *ChangedPtr);
 
 /*
  * Interrupt Functions.
@@ -126,6 +126,16 @@ extern "C" {
 #define XDMAPCIE_CAP_PTR_LOC			GENMASK(7, 0)
 #define XDMAPCIE_CAP_SHIFT				8
 #define XDMAPCIE_DOUBLEWORD(x)			(x / 4)
+
+/* PCI Express capability */
+#define XDMAPCIE_CAP_ID_PCIE			0x10
+#define XDMAPCIE_CAP_PCIE_TYPE_MASK		0x00F00000
+#define XDMAPCIE_CAP_PCIE_TYPE_SHIFT		20
+#define XDMAPCIE_CAP_PCIE_TYPE_ROOT_PORT	0x4
+#define XDMAPCIE_CAP_PCIE_TYPE_DOWNSTREAM	0x6
+
+/* Standard BARs in a type 0 header */
+#define XDMAPCIE_CFG_MAX_NUM_OF_BARS		6
 #define CAP_PRESENT						(1)
 #define CAP_NOT_PRESENT					(0)
 
@@ -104,6 +104,8 @@ s32 XZDma_CfgInitialize(XZDma *InstancePtr, XZDma_Config *CfgPtr,
 	InstancePtr->Mode = XZDMA_NORMAL_MODE;
 	InstancePtr->IntrMask = 0x00U;
 	InstancePtr->ChannelState = XZDMA_IDLE;
+	InstancePtr->MemCpyDst = 0U;
+	InstancePtr->MemCpySize = 0U;
 
 	/*
 	 * Set all handlers to stub values, let user configure this
@@ -116,6 +116,8 @@
 *                        in applications directly.
 * 1.14	adk	03/15/22 Fixed syntax errors in zdma_tapp.tcl file, when stdout
 * 			 is configured as none.
+* 1.16  agt     10/18/26 Added prebuilt descriptor chains, 2D copy helper
+*                        and memory copy front end.
 * </pre>
 *
 ******************************************************************************/
@@ -137,6 +139,11 @@ extern "C" {
 
 /************************** Constant Definitions *****************************/
 
+#ifndef XZDMA_MEMCPY_THRESHOLD
+#define XZDMA_MEMCPY_THRESHOLD	(4096U)	/**< Copies smaller than this are
+					  *  done by the CPU in
+					  *  XZDma_MemCpyAsync */
+#endif
 
 /**************************** Type Definitions *******************************/
 
@@ -335,6 +342,9 @@ typedef struct {
 	XZDma_DataConfig DataConfig;	/**< Current configurations */
 	XZDma_DscrConfig DscrConfig;	/**< Current configurations */
 	XZDmaState ChannelState;	 /**< ZDMA channel is busy */
+	UINTPTR MemCpyDst;		/**< Destination of the copy started
+					  *  by XZDma_MemCpyAsync */
+	u32 MemCpySize;			/**< Size of that copy, 0 if none */
 
 } XZDma;
 
@@ -353,6 +363,36 @@ typedef struct {
 				  *  this transfer only for SG mode */
 } XZDma_Transfer;
 
+/**
+ * This typedef contains the fields of a 2D strided copy, done with one
+ * descriptor per row.
+ */
+typedef struct {
+	UINTPTR SrcAddr;	/**< Address of the first source row */
+	UINTPTR DstAddr;	/**< Address of the first destination row */
+	u32 RowSize;		/**< Bytes copied per row */
+	u32 Rows;		/**< Number of rows */
+	u32 SrcStride;		/**< Bytes between source rows */
+	u32 DstStride;		/**< Bytes between destination rows */
+	u8 SrcCoherent;		/**< Source coherent */
+	u8 DstCoherent;		/**< Destination coherent */
+} XZDma_Transfer2D;
+
+/**
+ * This typedef contains a descriptor chain which is built once and can be
+ * started any number of times with XZDma_StartChain.
+ */
+typedef struct {
+	void *SrcDscrPtr;	/**< Source Descriptor pointer */
+	void *DstDscrPtr;	/**< Destination Descriptor pointer */
+	u32 DscrCount;		/**< Count of descriptors available */
+	u32 NumDscr;		/**< Count of descriptors used */
+	XZDma_DscrType DscrType;/**< Type of descriptor either Linear or
+				  *  Linked list type */
+	u8 IsCacheCoherent;	/**< Descriptors need no cache maintenance */
+	u8 IsDirty;		/**< Descriptors changed since last flush */
+} XZDma_Chain;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -693,6 +733,18 @@ void XZDma_ScatterGather(XZDma *InstancePtr, XZDma_Transfer *Data,
 								u32 Num);
 void XZDma_Enable(XZDma *InstancePtr);
 
+u32 XZDma_ChainCreate(XZDma *InstancePtr, XZDma_Chain *Chain,
+		XZDma_DscrType TypeOfDscr, UINTPTR Dscr_MemPtr, u32 NoOfBytes);
+void XZDma_ChainReset(XZDma_Chain *Chain);
+s32 XZDma_ChainAdd(XZDma_Chain *Chain, XZDma_Transfer *Data, u32 Num);
+s32 XZDma_ChainAdd2D(XZDma_Chain *Chain, XZDma_Transfer2D *Data);
+s32 XZDma_StartChain(XZDma *InstancePtr, XZDma_Chain *Chain);
+
+s32 XZDma_MemCpyAsync(XZDma *InstancePtr, void *Dst, const void *Src,
+		u32 Cnt);
+s32 XZDma_MemCpyWait(XZDma *InstancePtr);
+s32 XZDma_MemCpy(XZDma *InstancePtr, void *Dst, const void *Src, u32 Cnt);
+
 /*@}*/
 
 #ifdef __cplusplus
@@ -0,0 +1,412 @@
+/******************************************************************************
+* Copyright (C) 2022 - 2023 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_chain.c
+* @addtogroup zdma_v1_14
+* @{
+*
+* This file contains the prebuilt descriptor chain functions of the ZDMA
+* driver.
+*
+* A chain is built once, with any number of XZDma_ChainAdd() and
+* XZDma_ChainAdd2D() calls, and can then be started again and again with
+* XZDma_StartChain(). Unlike XZDma_Start(), descriptors are not flushed one
+* by one while they are written; the whole descriptor memory of the chain is
+* flushed once, on the first start after it was changed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.16  agt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xzdma.h"
+
+/************************** Function Prototypes ******************************/
+
+static void XZDma_ChainLink(XZDma_Chain *Chain);
+static void XZDma_ChainAppend(XZDma_Chain *Chain, XZDma_Transfer *Data);
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a descriptor chain on the memory allocated by
+* the user. The memory is split in the same way as by XZDma_CreateBDList,
+* half for the source and half for the destination descriptors.
+*
+* @param	InstancePtr is a pointer to the XZDma instance.
+* @param	Chain is a pointer to the chain to be initialized.
+* @param	TypeOfDscr is a variable which specifies descriptor type
+*		whether Linear or linked list type of descriptor.
+*		- XZDMA_LINEAR    - Linear type of descriptor.
+*		- XZDMA_LINKEDLIST- Linked list type of descriptor.
+* @param	Dscr_MemPtr is a pointer to the allocated memory for creating
+*		descriptors. It Should be aligned to 64 bytes.
+* @param	NoOfBytes specifies the number of bytes allocated for
+*		descriptors
+*
+* @return	The Count of the descriptors can be created.
+*
+* @note		The chain is independent of the descriptors set by
+*		XZDma_CreateBDList, several chains can be kept and started
+*		one after the other on the same channel.
+*
+******************************************************************************/
+u32 XZDma_ChainCreate(XZDma *InstancePtr, XZDma_Chain *Chain,
+		XZDma_DscrType TypeOfDscr, UINTPTR Dscr_MemPtr, u32 NoOfBytes)
+{
+	UINTPTR Size;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Chain != NULL);
+	Xil_AssertNonvoid((TypeOfDscr == XZDMA_LINEAR) ||
+					(TypeOfDscr == XZDMA_LINKEDLIST));
+	Xil_AssertNonvoid(Dscr_MemPtr != 0x00);
+	Xil_AssertNonvoid(NoOfBytes != 0x00U);
+
+	if (TypeOfDscr == XZDMA_LINEAR) {
+		Size = sizeof(XZDma_LiDscr);
+	}
+	else {
+		Size = sizeof(XZDma_LlDscr);
+	}
+
+	Chain->DscrType = TypeOfDscr;
+	Chain->DscrCount = (NoOfBytes >> 1) / Size;
+	Chain->SrcDscrPtr = (void *)Dscr_MemPtr;
+	Chain->DstDscrPtr = (void *)(Dscr_MemPtr + (Size * Chain->DscrCount));
+	Chain->IsCacheCoherent = (u8)InstancePtr->Config.IsCacheCoherent;
+	Chain->NumDscr = 0x00U;
+	Chain->IsDirty = FALSE;
+
+	if (!InstancePtr->Config.IsCacheCoherent) {
+		Xil_DCacheInvalidateRange((INTPTR)Dscr_MemPtr, NoOfBytes);
+	}
+
+	return Chain->DscrCount;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function empties a descriptor chain so that it can be built again.
+*
+* @param	Chain is a pointer to the chain.
+*
+* @return	None.
+*
+* @note		The chain must not be reset while it is being processed.
+*
+******************************************************************************/
+void XZDma_ChainReset(XZDma_Chain *Chain)
+{
+	/* Verify arguments */
+	Xil_AssertVoid(Chain != NULL);
+
+	Chain->NumDscr = 0x00U;
+	Chain->IsDirty = FALSE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function appends transfers to a descriptor chain, one source and one
+* destination descriptor per transfer. The previous last descriptor of the
+* chain is linked to the first new one.
+*
+* @param	Chain is a pointer to the chain.
+* @param	Data is a pointer of array to the XZDma_Transfer structure
+*		which has all the configuration fields of the transfers.
+* @param	Num specifies number of array elements of Data pointer.
+*
+* @return
+*		- XST_SUCCESS - if the transfers are added.
+*		- XST_FAILURE - if the chain has no room for Num transfers.
+*
+* @note		The Pause field of a transfer is honored in the same way as
+*		by XZDma_Start.
+*
+******************************************************************************/
+s32 XZDma_ChainAdd(XZDma_Chain *Chain, XZDma_Transfer *Data, u32 Num)
+{
+	s32 Status;
+	u32 Count;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(Chain != NULL);
+	Xil_AssertNonvoid(Data != NULL);
+	Xil_AssertNonvoid(Num != 0x00U);
+
+	if (Num > (Chain->DscrCount - Chain->NumDscr)) {
+		Status = XST_FAILURE;
+		goto END;
+	}
+
+	for (Count = 0x00U; Count < Num; Count++) {
+		XZDma_ChainAppend(Chain, &Data[Count]);
+	}
+
+	Chain->IsDirty = TRUE;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function appends a 2D strided copy to a descriptor chain, using one
+* source and one destination descriptor per row.
+*
+* @param	Chain is a pointer to the chain.
+* @param	Data is a pointer to the XZDma_Transfer2D structure which
+*		describes the copy.
+*
+* @return
+*		- XST_SUCCESS - if the copy is added.
+*		- XST_FAILURE - if the chain has no room for all the rows.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_ChainAdd2D(XZDma_Chain *Chain, XZDma_Transfer2D *Data)
+{
+	s32 Status;
+	u32 Row;
+	XZDma_Transfer RowData;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(Chain != NULL);
+	Xil_AssertNonvoid(Data != NULL);
+	Xil_AssertNonvoid(Data->Rows != 0x00U);
+	Xil_AssertNonvoid(Data->RowSize != 0x00U);
+
+	if (Data->Rows > (Chain->DscrCount - Chain->NumDscr)) {
+		Status = XST_FAILURE;
+		goto END;
+	}
+
+	RowData.SrcAddr = Data->SrcAddr;
+	RowData.DstAddr = Data->DstAddr;
+	RowData.Size = Data->RowSize;
+	RowData.SrcCoherent = Data->SrcCoherent;
+	RowData.DstCoherent = Data->DstCoherent;
+	RowData.Pause = FALSE;
+
+	for (Row = 0x00U; Row < Data->Rows; Row++) {
+		XZDma_ChainAppend(Chain, &RowData);
+		RowData.SrcAddr += Data->SrcStride;
+		RowData.DstAddr += Data->DstStride;
+	}
+
+	Chain->IsDirty = TRUE;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts a prebuilt descriptor chain. The descriptors are
+* flushed only if the chain was changed since it was last started.
+*
+* @param	InstancePtr is a pointer to the XZDma instance.
+* @param	Chain is a pointer to the chain.
+*
+* @return
+*		- XST_SUCCESS - if ZDMA initiated the transfer.
+*		- XST_FAILURE - if the channel is not in scatter gather mode,
+*		  is busy or the chain is empty.
+*
+* @note		Completion is reported in the same way as for XZDma_Start.
+*
+******************************************************************************/
+s32 XZDma_StartChain(XZDma *InstancePtr, XZDma_Chain *Chain)
+{
+	s32 Status = XST_FAILURE;
+	UINTPTR Size;
+	u64 LocalAddr;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Chain != NULL);
+
+	if ((InstancePtr->IsSgDma != TRUE) || (Chain->NumDscr == 0x00U)) {
+		goto END;
+	}
+
+	if (XZDma_ChannelState(InstancePtr) == XZDMA_BUSY) {
+		goto END;
+	}
+
+	if ((Chain->IsDirty == TRUE) && (Chain->IsCacheCoherent == 0U)) {
+		if (Chain->DscrType == XZDMA_LINEAR) {
+			Size = sizeof(XZDma_LiDscr);
+		}
+		else {
+			Size = sizeof(XZDma_LlDscr);
+		}
+		Xil_DCacheFlushRange((UINTPTR)Chain->SrcDscrPtr,
+				     Size * Chain->NumDscr);
+		Xil_DCacheFlushRange((UINTPTR)Chain->DstDscrPtr,
+				     Size * Chain->NumDscr);
+	}
+	Chain->IsDirty = FALSE;
+
+	XZDma_WriteReg(InstancePtr->Config.BaseAddress,
+		XZDMA_CH_SRC_START_LSB_OFFSET,
+		((UINTPTR)(Chain->SrcDscrPtr) & XZDMA_WORD0_LSB_MASK));
+	LocalAddr = (u64)(UINTPTR)(Chain->SrcDscrPtr);
+	XZDma_WriteReg(InstancePtr->Config.BaseAddress,
+		XZDMA_CH_SRC_START_MSB_OFFSET,
+		((LocalAddr >> XZDMA_WORD1_MSB_SHIFT) & XZDMA_WORD1_MSB_MASK));
+	XZDma_WriteReg(InstancePtr->Config.BaseAddress,
+		XZDMA_CH_DST_START_LSB_OFFSET,
+		((UINTPTR)(Chain->DstDscrPtr) & XZDMA_WORD0_LSB_MASK));
+	LocalAddr = (u64)(UINTPTR)(Chain->DstDscrPtr);
+	XZDma_WriteReg(InstancePtr->Config.BaseAddress,
+		XZDMA_CH_DST_START_MSB_OFFSET,
+		((LocalAddr >> XZDMA_WORD1_MSB_SHIFT) & XZDMA_WORD1_MSB_MASK));
+
+	XZDma_Enable(InstancePtr);
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function links the current last descriptor pair of a chain to
+* the next free one, before a new pair is appended. A descriptor
+* which pauses the channel keeps its pause command.
+*
+* @param	Chain is a pointer to the chain.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XZDma_ChainLink(XZDma_Chain *Chain)
+{
+	u32 Last;
+	u32 Cmd;
+	XZDma_LiDscr *LiSrcDscr;
+	XZDma_LlDscr *LlSrcDscr;
+	XZDma_LlDscr *LlDstDscr;
+
+	if (Chain->NumDscr == 0x00U) {
+		return;
+	}
+
+	Last = Chain->NumDscr - 1U;
+
+	if (Chain->DscrType == XZDMA_LINEAR) {
+		LiSrcDscr = &((XZDma_LiDscr *)Chain->SrcDscrPtr)[Last];
+		Cmd = LiSrcDscr->Cntl & XZDMA_WORD3_CMD_MASK;
+		if (Cmd == XZDMA_WORD3_CMD_STOP_MASK) {
+			LiSrcDscr->Cntl = (LiSrcDscr->Cntl &
+					~XZDMA_WORD3_CMD_MASK) |
+					XZDMA_WORD3_CMD_NXTVALID_MASK;
+		}
+	}
+	else {
+		LlSrcDscr = &((XZDma_LlDscr *)Chain->SrcDscrPtr)[Last];
+		LlDstDscr = &((XZDma_LlDscr *)Chain->DstDscrPtr)[Last];
+		Cmd = LlSrcDscr->Cntl & XZDMA_WORD3_CMD_MASK;
+		if (Cmd == XZDMA_WORD3_CMD_STOP_MASK) {
+			LlSrcDscr->Cntl = (LlSrcDscr->Cntl &
+					~XZDMA_WORD3_CMD_MASK) |
+					XZDMA_WORD3_CMD_NXTVALID_MASK;
+		}
+		LlSrcDscr->NextDscr = (u64)(UINTPTR)(LlSrcDscr + 1);
+		LlDstDscr->NextDscr = (u64)(UINTPTR)(LlDstDscr + 1);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function appends one source and destination descriptor pair
+* to a chain which has room for it. The new pair ends the chain.
+*
+* @param	Chain is a pointer to the chain.
+* @param	Data is a pointer to the transfer to be written.
+*
+* @return	None.
+*
+* @note		No cache maintenance is done here, see XZDma_StartChain.
+*
+******************************************************************************/
+static void XZDma_ChainAppend(XZDma_Chain *Chain, XZDma_Transfer *Data)
+{
+	u32 SrcCntl;
+	u32 DstCntl = 0U;
+	u32 Index = Chain->NumDscr;
+	XZDma_LiDscr *LiDscr;
+	XZDma_LlDscr *LlDscr;
+
+	XZDma_ChainLink(Chain);
+
+	if (Data->Pause == TRUE) {
+		SrcCntl = XZDMA_WORD3_CMD_PAUSE_MASK;
+	}
+	else {
+		SrcCntl = XZDMA_WORD3_CMD_STOP_MASK;
+	}
+	if (Data->SrcCoherent == TRUE) {
+		SrcCntl |= XZDMA_WORD3_COHRNT_MASK;
+	}
+	if (Data->DstCoherent == TRUE) {
+		DstCntl |= XZDMA_WORD3_COHRNT_MASK;
+	}
+
+	if (Chain->DscrType == XZDMA_LINEAR) {
+		LiDscr = &((XZDma_LiDscr *)Chain->SrcDscrPtr)[Index];
+		LiDscr->Address = (u64)Data->SrcAddr;
+		LiDscr->Size = Data->Size & XZDMA_WORD2_SIZE_MASK;
+		LiDscr->Cntl = SrcCntl;
+
+		LiDscr = &((XZDma_LiDscr *)Chain->DstDscrPtr)[Index];
+		LiDscr->Address = (u64)Data->DstAddr;
+		LiDscr->Size = Data->Size & XZDMA_WORD2_SIZE_MASK;
+		LiDscr->Cntl = DstCntl;
+	}
+	else {
+		LlDscr = &((XZDma_LlDscr *)Chain->SrcDscrPtr)[Index];
+		LlDscr->Address = (u64)Data->SrcAddr;
+		LlDscr->Size = Data->Size & XZDMA_WORD2_SIZE_MASK;
+		LlDscr->Cntl = SrcCntl;
+		LlDscr->NextDscr = 0x00U;
+		LlDscr->Reserved = 0U;
+
+		LlDscr = &((XZDma_LlDscr *)Chain->DstDscrPtr)[Index];
+		LlDscr->Address = (u64)Data->DstAddr;
+		LlDscr->Size = Data->Size & XZDMA_WORD2_SIZE_MASK;
+		LlDscr->Cntl = DstCntl;
+		LlDscr->NextDscr = 0x00U;
+		LlDscr->Reserved = 0U;
+	}
+
+	Chain->NumDscr++;
+}
+/** @} */
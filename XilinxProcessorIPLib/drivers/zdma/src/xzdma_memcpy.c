@@ -0,0 +1,175 @@
+/******************************************************************************
+* Copyright (C) 2022 - 2023 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_memcpy.c
+* @addtogroup zdma_v1_14
+* @{
+*
+* This file contains a memory copy front end of the ZDMA driver, with the
+* same arguments as Xil_MemCpy.
+*
+* Copies of at least XZDMA_MEMCPY_THRESHOLD bytes are done by the channel in
+* simple mode, smaller ones, for which the cache maintenance and channel
+* setup cost more than the copy itself, are done by the CPU. The CPU is also
+* used whenever the channel cannot take the copy, so the functions always
+* succeed in copying the data.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.16  agt     10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xzdma.h"
+#include "xil_mem.h"
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function starts copying Cnt bytes from Src to Dst. The copy is done
+* by the CPU before returning if it is smaller than XZDMA_MEMCPY_THRESHOLD,
+* if the channel is in scatter gather or in a read or write only mode, or if
+* a previous copy or transfer is still in progress.
+*
+* @param	InstancePtr is a pointer to the XZDma instance.
+* @param	Dst is the destination address.
+* @param	Src is the source address.
+* @param	Cnt is the number of bytes to copy.
+*
+* @return	XST_SUCCESS always.
+*
+* @note		XZDma_MemCpyWait must be called before Dst is used. Src and
+*		Dst must not be accessed by the CPU until then.
+*
+******************************************************************************/
+s32 XZDma_MemCpyAsync(XZDma *InstancePtr, void *Dst, const void *Src,
+		u32 Cnt)
+{
+	XZDma_Transfer Data;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Dst != NULL);
+	Xil_AssertNonvoid(Src != NULL);
+
+	if ((Cnt < XZDMA_MEMCPY_THRESHOLD) ||
+			(Cnt > XZDMA_WORD2_SIZE_MASK) ||
+			(InstancePtr->IsSgDma == TRUE) ||
+			(InstancePtr->Mode != XZDMA_NORMAL_MODE) ||
+			(InstancePtr->MemCpySize != 0x00U) ||
+			(XZDma_ChannelState(InstancePtr) == XZDMA_BUSY)) {
+		Xil_MemCpy(Dst, Src, Cnt);
+		goto END;
+	}
+
+	if (!InstancePtr->Config.IsCacheCoherent) {
+		Xil_DCacheFlushRange((UINTPTR)Src, Cnt);
+		/* Write back dirty lines which could land on top of the copy */
+		Xil_DCacheFlushRange((UINTPTR)Dst, Cnt);
+	}
+
+	Data.SrcAddr = (UINTPTR)Src;
+	Data.DstAddr = (UINTPTR)Dst;
+	Data.Size = Cnt;
+	Data.SrcCoherent = (u8)InstancePtr->Config.IsCacheCoherent;
+	Data.DstCoherent = (u8)InstancePtr->Config.IsCacheCoherent;
+	Data.Pause = FALSE;
+
+	InstancePtr->MemCpyDst = (UINTPTR)Dst;
+	InstancePtr->MemCpySize = Cnt;
+
+	XZDma_IntrClear(InstancePtr, XZDMA_IXR_ALL_INTR_MASK);
+	(void)XZDma_Start(InstancePtr, &Data, 1U);
+
+END:
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function waits for the copy started by XZDma_MemCpyAsync to finish.
+* It returns at once if there is none.
+*
+* @param	InstancePtr is a pointer to the XZDma instance.
+*
+* @return
+*		- XST_SUCCESS - if the copy is done.
+*		- XST_FAILURE - if the channel reported an error.
+*
+* @note		If the ZDMA interrupt handler is in use, completion is also
+*		detected from the channel state it updates.
+*
+******************************************************************************/
+s32 XZDma_MemCpyWait(XZDma *InstancePtr)
+{
+	s32 Status = XST_SUCCESS;
+	u32 PendingIntr;
+	u32 ErrMask = XZDMA_IXR_ERR_MASK & ~XZDMA_IXR_DMA_PAUSE_MASK;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if (InstancePtr->MemCpySize == 0x00U) {
+		goto END;
+	}
+
+	do {
+		PendingIntr = XZDma_IntrGetStatus(InstancePtr);
+	} while (((PendingIntr & (XZDMA_IXR_DMA_DONE_MASK | ErrMask)) ==
+			0x00U) && (InstancePtr->ChannelState == XZDMA_BUSY));
+
+	if ((PendingIntr & ErrMask) != 0x00U) {
+		Status = XST_FAILURE;
+	}
+	XZDma_IntrClear(InstancePtr, PendingIntr);
+	InstancePtr->ChannelState = XZDMA_IDLE;
+
+	if (!InstancePtr->Config.IsCacheCoherent) {
+		Xil_DCacheInvalidateRange((INTPTR)InstancePtr->MemCpyDst,
+					  InstancePtr->MemCpySize);
+	}
+	InstancePtr->MemCpySize = 0x00U;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function copies Cnt bytes from Src to Dst and waits for the copy to
+* finish, see XZDma_MemCpyAsync.
+*
+* @param	InstancePtr is a pointer to the XZDma instance.
+* @param	Dst is the destination address.
+* @param	Src is the source address.
+* @param	Cnt is the number of bytes to copy.
+*
+* @return
+*		- XST_SUCCESS - if the copy is done.
+*		- XST_FAILURE - if the channel reported an error.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_MemCpy(XZDma *InstancePtr, void *Dst, const void *Src, u32 Cnt)
+{
+	(void)XZDma_MemCpyAsync(InstancePtr, Dst, Src, Cnt);
+
+	return XZDma_MemCpyWait(InstancePtr);
+}
+/** @} */
@@ -17,6 +17,8 @@
 * Ver   Who  Date        Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  kc   04/21/14 Initial release
+*       agt  10/18/26 Count the bad blocks before the image with
+*                     XNandPsu_CountBadBlocks
 *
 * </pre>
 *
@@ -109,6 +111,7 @@ u32 XFsbl_NandCopy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
 	u32 CurrentBlock;
 	u32 RealSrcAddress;
 	u32 NoofBlocks;
+	u32 NoofBadBlocks;
 
 	/**
 	 * Read the Multiboot Register
@@ -119,19 +122,18 @@ u32 XFsbl_NandCopy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
 	NoofBlocks= ((SrcAddress - FlashImageOffsetAddress) / NandInstPtr->Geometry.BlockSize) + 1;
 	RealSrcAddress=SrcAddress;
 
-	while(NoofBlocks > 0)
+	NoofBadBlocks = XNandPsu_CountBadBlocks(NandInstPtr, CurrentBlock,
+						NoofBlocks);
+	if (NoofBadBlocks > 0U)
 	{
-		if (XNandPsu_IsBlockBad(NandInstPtr, CurrentBlock) == XST_SUCCESS)
-		{
-			XFsbl_Printf(DEBUG_DETAILED, "Identified block (%d) as bad\r\n",
-											CurrentBlock);
-			RealSrcAddress= RealSrcAddress + NandInstPtr->Geometry.BlockSize ;
-			XFsbl_Printf(DEBUG_DETAILED,
-						"Src Address: %x, Calculated real Address:%x\r\n",
-						SrcAddress, RealSrcAddress);
-		}
-		CurrentBlock+=1;
-		NoofBlocks-=1;
+		RealSrcAddress = RealSrcAddress +
+			(NoofBadBlocks * NandInstPtr->Geometry.BlockSize);
+		XFsbl_Printf(DEBUG_DETAILED,
+			"Identified %d bad blocks from block %d\r\n",
+			NoofBadBlocks, CurrentBlock);
+		XFsbl_Printf(DEBUG_DETAILED,
+			"Src Address: %x, Calculated real Address:%x\r\n",
+			SrcAddress, RealSrcAddress);
 	}
 
 	Status = (u32)XNandPsu_Read(NandInstPtr, (u64)(RealSrcAddress),(u64)Length,
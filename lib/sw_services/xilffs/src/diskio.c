@@ -67,6 +67,8 @@
 * 4.5   sk   03/31/21 Maintain discrete global variables for each controller.
 * 4.6   sk   07/20/21 Fixed compilation warning in RAM interface.
 * 4.8   sk   05/05/22 Replace standard lib functions with Xilinx functions.
+* 5.0   agt  10/18/26 Split SD transfers larger than one ADMA2 descriptor
+*                     table in disk_read() and disk_write().
 *
 * </pre>
 *
@@ -87,6 +89,12 @@
 #define SD_CD_DELAY		10000U
 #define XSDPS_NUM_INSTANCES	2
 
+#ifdef FILE_SYSTEM_INTERFACE_SD
+/* Most sectors one ADMA2 descriptor table can move */
+#define SD_MAX_XFER_SECT	((XSDPS_ADMA2_DESC_NUM * XSDPS_DESC_MAX_LENGTH) / \
+				 XSDPS_BLK_SIZE_512_MASK)
+#endif
+
 #ifdef FILE_SYSTEM_INTERFACE_RAM
 #include "xparameters.h"
 
@@ -349,6 +357,7 @@ DRESULT disk_read (
 #ifdef FILE_SYSTEM_INTERFACE_SD
 	s32 Status = XST_FAILURE;
 	DWORD LocSector = sector;
+	UINT Cnt;
 #endif
 
 	s = disk_status(pdrv);
@@ -366,9 +375,18 @@ DRESULT disk_read (
 		LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
 	}
 
-	Status  = XSdPs_ReadPolled(&SdInstance[pdrv], (u32)LocSector, count, buff);
-	if (Status != XST_SUCCESS) {
-		return RES_ERROR;
+	/* Large reads are split to fit the ADMA2 descriptor table */
+	while (count > 0U) {
+		Cnt = (count > SD_MAX_XFER_SECT) ? SD_MAX_XFER_SECT : count;
+		Status  = XSdPs_ReadPolled(&SdInstance[pdrv], (u32)LocSector,
+					   Cnt, buff);
+		if (Status != XST_SUCCESS) {
+			return RES_ERROR;
+		}
+		buff += Cnt * XSDPS_BLK_SIZE_512_MASK;
+		LocSector += ((SdInstance[pdrv].HCS) == 0U) ?
+			(Cnt * XSDPS_BLK_SIZE_512_MASK) : Cnt;
+		count -= Cnt;
 	}
 #endif
 
@@ -520,6 +538,7 @@ DRESULT disk_write (
 #ifdef FILE_SYSTEM_INTERFACE_SD
 	s32 Status = XST_FAILURE;
 	DWORD LocSector = sector;
+	UINT Cnt;
 #endif
 
 	s = disk_status(pdrv);
@@ -536,9 +555,18 @@ DRESULT disk_write (
 		LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
 	}
 
-	Status  = XSdPs_WritePolled(&SdInstance[pdrv], (u32)LocSector, count, buff);
-	if (Status != XST_SUCCESS) {
-		return RES_ERROR;
+	/* Large writes are split to fit the ADMA2 descriptor table */
+	while (count > 0U) {
+		Cnt = (count > SD_MAX_XFER_SECT) ? SD_MAX_XFER_SECT : count;
+		Status  = XSdPs_WritePolled(&SdInstance[pdrv], (u32)LocSector,
+					    Cnt, buff);
+		if (Status != XST_SUCCESS) {
+			return RES_ERROR;
+		}
+		buff += Cnt * XSDPS_BLK_SIZE_512_MASK;
+		LocSector += ((SdInstance[pdrv].HCS) == 0U) ?
+			(Cnt * XSDPS_BLK_SIZE_512_MASK) : Cnt;
+		count -= Cnt;
 	}
 
 #endif
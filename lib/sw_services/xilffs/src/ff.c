@@ -31,6 +31,8 @@
 *       mn   04/23/20 Add partition 0 for supporting default partition
 * 4.7   sk   11/11/21 Add DCache invalidate for last unaligned byte count
 *                     (< 512 bytes) in f_read().
+* 5.0   agt  10/18/26 Extend direct sector transfers in f_read() and f_write()
+*                     over physically contiguous clusters.
 ******************************************************************************/
 #include "xparameters.h"
 #if (defined FILE_SYSTEM_INTERFACE_SD) || (defined FILE_SYSTEM_INTERFACE_RAM)
@@ -3963,6 +3965,36 @@ FRESULT f_open (
 
 
 
+/*-----------------------------------------------------------------------*/
+/* Follow physically contiguous clusters for a direct transfer           */
+/*-----------------------------------------------------------------------*/
+
+static UINT next_contig (	/* Number of sectors in the contiguous clusters following fp->clust */
+	FIL* fp,		/* Pointer to the file object, fp->clust is moved to the last cluster taken */
+	UINT nsect		/* Number of sectors wanted past the current cluster */
+)
+{
+	FATFS *fs = fp->obj.fs;
+	DWORD clst = fp->clust, nxt;
+	UINT cc = 0;
+
+
+#if FF_USE_FASTSEEK
+	if (fp->cltbl) return 0;	/* Not used with the CLMT */
+#endif
+	while (nsect - cc >= fs->csize) {	/* Only whole clusters are taken */
+		nxt = get_fat(&fp->obj, clst);
+		if (nxt != clst + 1 || nxt >= fs->n_fatent) break;	/* End of the contiguous run or error */
+		clst = nxt;
+		cc += fs->csize;
+	}
+	fp->clust = clst;
+	return cc;
+}
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Read File                                                             */
 /*-----------------------------------------------------------------------*/
@@ -4015,8 +4047,8 @@ FRESULT f_read (
 			sect += csect;
 			cc = btr / SS(fs);					/* When remaining bytes >= sector size, */
 			if (cc > 0) {						/* Read maximum contiguous sectors directly */
-				if (csect + cc > fs->csize) {	/* Clip at cluster boundary */
-					cc = fs->csize - csect;
+				if (csect + cc > fs->csize) {	/* Clip at the end of the contiguous clusters */
+					cc = fs->csize - csect + next_contig(fp, cc - (fs->csize - csect));
 				}
 				if (disk_read(fs->pdrv, rbuff, sect, cc) != RES_OK) ABORT(fs, FR_DISK_ERR);
 #if !FF_FS_READONLY && FF_FS_MINIMIZE <= 2		/* Replace one of the read sectors with cached data if it contains a dirty sector */
@@ -4138,8 +4170,8 @@ FRESULT f_write (
 			sect += csect;
 			cc = btw / SS(fs);				/* When remaining bytes >= sector size, */
 			if (cc > 0) {					/* Write maximum contiguous sectors directly */
-				if (csect + cc > fs->csize) {	/* Clip at cluster boundary */
-					cc = fs->csize - csect;
+				if (csect + cc > fs->csize) {	/* Clip at the end of the contiguous clusters */
+					cc = fs->csize - csect + next_contig(fp, cc - (fs->csize - csect));
 				}
 				if (disk_write(fs->pdrv, wbuff, sect, cc) != RES_OK) ABORT(fs, FR_DISK_ERR);
 #if FF_FS_MINIMIZE <= 2
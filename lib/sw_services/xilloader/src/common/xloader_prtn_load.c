@@ -97,6 +97,8 @@
 *       bm   01/05/2023 Clear End Stack before processing a CDO partition
 *       bm   01/03/2023 Notify Other SLRs about Secure Lockdown
 *       ng   03/30/2023 Updated algorithm and return values in doxygen comments
+*       sp   10/18/2026 Overlap independent data partition copies on PMCDMA0
+*                       and PMCDMA1 when loading from DDR
 *
 * </pre>
 *
@@ -125,8 +127,22 @@
 #include "xplmi_tamper.h"
 
 /************************** Constant Definitions *****************************/
+#define XLOADER_PRTN_XFER_SLOTS		(2U) /**< One in-flight copy per PMC DMA */
 
 /**************************** Type Definitions *******************************/
+/* Non-blocking data partition copy issued on one of the PMC DMAs */
+typedef struct {
+	u64 DestAddr;	/**< Destination address of the partition */
+	u64 StartTime;	/**< Timer value when the copy was issued */
+	u32 Len;	/**< Length of the copy in bytes */
+	u32 PrtnNum;	/**< Partition number in the PDI */
+	u32 DmaFlags;	/**< PMC DMA used for the copy */
+	u32 PcrInfo;	/**< PCR info of the image for data measurement */
+	u32 MeasureLen;	/**< Unencrypted data length for data measurement */
+	int (*DeviceCopy) (u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags);
+			/**< Copy function the copy was issued with */
+	u8 InFlight;	/**< Copy has been issued and not yet completed */
+} XLoader_PrtnXfer;
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XLOADER_SUCCESS_NOT_PRTN_OWNER	(0x100U) /**< Indicates that PLM is not the partition owner */
@@ -136,8 +152,18 @@ static int XLoader_PrtnHdrValidation(const XilPdi_PrtnHdr* PrtnHdr, u32 PrtnNum)
 static int XLoader_ProcessPrtn(XilPdi* PdiPtr, u32 PrtnIndex);
 static int XLoader_ProcessCdo (const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCopy,
 	XLoader_SecureParams* SecureParams);
+static u8 XLoader_IsPrtnCopyAsync(const XilPdi* PdiPtr, u32 PrtnIndex);
+static int XLoader_PrtnCopyAsync(const XilPdi* PdiPtr,
+	const XLoader_DeviceCopy* DeviceCopy);
+static int XLoader_PrtnXferDrain(void);
+static u8 XLoader_IsPrtnXferPending(u32 PrtnNum);
 
 /************************** Variable Definitions *****************************/
+/*
+ * Copies in issue order. Slot 0 always uses PMCDMA1 and slot 1 PMCDMA0, and
+ * both are drained together, so completion is handled in issue order.
+ */
+static XLoader_PrtnXfer PrtnXfers[XLOADER_PRTN_XFER_SLOTS];
 
 /*****************************************************************************/
 /**
@@ -243,12 +269,17 @@ int XLoader_LoadImagePrtns(XilPdi* PdiPtr)
 		if (XST_SUCCESS != Status) {
 			goto END;
 		}
-		XPlmi_MeasurePerfTime(PrtnLoadTime, &PerfTime);
-		XPlmi_Printf(DEBUG_PRINT_PERF,
-			" %u.%03u ms for Partition#: 0x%0x, Size: %u Bytes\n\r",
-			(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac, PdiPtr->PrtnNum,
-			(PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].TotalDataWordLen) *
-			XPLMI_WORD_LEN);
+		/**
+		 * - Copies still in flight are reported once they complete.
+		 */
+		if (XLoader_IsPrtnXferPending(PdiPtr->PrtnNum) == (u8)FALSE) {
+			XPlmi_MeasurePerfTime(PrtnLoadTime, &PerfTime);
+			XPlmi_Printf(DEBUG_PRINT_PERF,
+				" %u.%03u ms for Partition#: 0x%0x, Size: %u Bytes\n\r",
+				(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac, PdiPtr->PrtnNum,
+				(PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].TotalDataWordLen) *
+				XPLMI_WORD_LEN);
+		}
 
 		++PdiPtr->PrtnNum;
 
@@ -269,7 +300,11 @@ int XLoader_LoadImagePrtns(XilPdi* PdiPtr)
 			}
 		}
 	}
-	Status = XST_SUCCESS;
+
+	/**
+	 * - Wait for the partition copies still in flight.
+	 */
+	Status = XLoader_PrtnXferDrain();
 
 END:
 	if (Status != XST_SUCCESS) {
@@ -278,6 +313,10 @@ END:
 		}
 	}
 END1:
+	if (Status != XST_SUCCESS) {
+		/* Never leave a DMA running into memory on the error path */
+		(void)XLoader_PrtnXferDrain();
+	}
 	return Status;
 }
 
@@ -632,6 +671,7 @@ static int XLoader_ProcessPrtn(XilPdi* PdiPtr, u32 PrtnIndex)
 	u32 PdiSrc = PdiPtr->PdiSrc;
 	int (*DevCopy) (u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags) = NULL;
 	XLoader_SecureParams SecureParams;
+	XLoader_SecureTempParams *SecureTempParams = XLoader_GetTempParams();
 	XLoader_PrtnParams PrtnParams;
 	u32 PrtnType;
 	u64 OfstAddr = 0U;
@@ -648,6 +688,17 @@ static int XLoader_ProcessPrtn(XilPdi* PdiPtr, u32 PrtnIndex)
 	/** Read Partition Type */
 	PrtnType = XilPdi_GetPrtnType(PrtnHdr);
 
+	/**
+	 * Everything but a plain data copy may depend on, or use the DMAs for,
+	 * data of earlier partitions, so finish the copies in flight first.
+	 */
+	if (XLoader_IsPrtnCopyAsync(PdiPtr, PrtnIndex) == (u8)FALSE) {
+		Status = XLoader_PrtnXferDrain();
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
 	PrtnParams.DeviceCopy.DestAddr = PrtnHdr->DstnLoadAddr;
 	PrtnParams.DeviceCopy.Len = (PrtnHdr->TotalDataWordLen <<
 		XPLMI_WORD_LEN_SHIFT);
@@ -764,6 +815,13 @@ static int XLoader_ProcessPrtn(XilPdi* PdiPtr, u32 PrtnIndex)
 		XPlmi_Printf(DEBUG_INFO, "Copying elf partitions\n\r");
 		Status = XLoader_ProcessElf(PdiPtr, PrtnHdr, &PrtnParams, &SecureParams);
 	}
+	else if ((XLoader_IsPrtnCopyAsync(PdiPtr, PrtnIndex) == (u8)TRUE) &&
+		(SecureParams.SecureEn == (u8)FALSE) &&
+		(SecureTempParams->SecureEn == (u8)FALSE) &&
+		(SecureParams.IsCheckSumEnabled == (u8)FALSE)) {
+		XPlmi_Printf(DEBUG_INFO, "Issuing data partition copy\n\r");
+		Status = XLoader_PrtnCopyAsync(PdiPtr, &PrtnParams.DeviceCopy);
+	}
 	else {
 		XPlmi_Printf(DEBUG_INFO, "Copying data partition\n\r");
 		/* Partition Copy */
@@ -787,3 +845,219 @@ END:
 	}
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks if a partition can be copied with a
+ * 			non-blocking DMA transfer while the next partitions are processed.
+ *
+ * @param	PdiPtr is pointer to XilPdi instance
+ * @param	PrtnIndex is the index of the partition in the image
+ *
+ * @return
+ * 			- TRUE if the partition is a plain, unsecured data partition
+ * 			loaded from DDR, FALSE otherwise.
+ *
+ *****************************************************************************/
+static u8 XLoader_IsPrtnCopyAsync(const XilPdi* PdiPtr, u32 PrtnIndex)
+{
+	u8 IsAsync = (u8)FALSE;
+	const XilPdi_PrtnHdr *PrtnHdr = &(PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum]);
+	u32 PrtnType = XilPdi_GetPrtnType(PrtnHdr);
+
+	/**
+	 * - Only DDR sources can drive both PMC DMAs, and only data partitions
+	 * without authentication, encryption or checksum are independent of
+	 * the secure engines which share the DMAs.
+	 */
+	if ((PdiPtr->MetaHdr.DeviceCopy == XLoader_DdrCopy) &&
+		(PdiPtr->CopyToMem == (u8)FALSE) &&
+		(PdiPtr->DelayLoad == (u8)FALSE) &&
+		(PrtnIndex != 0x00U) &&
+		(PrtnType != XIH_PH_ATTRB_PRTN_TYPE_CDO) &&
+		(PrtnType != XIH_PH_ATTRB_PRTN_TYPE_ELF) &&
+		(PrtnHdr->AuthCertificateOfst == 0x00U) &&
+		(PrtnHdr->EncStatus == 0x00U) &&
+		(XilPdi_GetChecksumType(PrtnHdr) == 0x00U)) {
+		IsAsync = (u8)TRUE;
+	}
+
+	return IsAsync;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks if the copy of a partition is still in
+ * 			flight.
+ *
+ * @param	PrtnNum is the partition number in the PDI
+ *
+ * @return
+ * 			- TRUE if the copy has been issued and not completed yet.
+ *
+ *****************************************************************************/
+static u8 XLoader_IsPrtnXferPending(u32 PrtnNum)
+{
+	u8 IsPending = (u8)FALSE;
+	u32 Slot;
+
+	for (Slot = 0U; Slot < XLOADER_PRTN_XFER_SLOTS; ++Slot) {
+		if ((PrtnXfers[Slot].InFlight == (u8)TRUE) &&
+			(PrtnXfers[Slot].PrtnNum == PrtnNum)) {
+			IsPending = (u8)TRUE;
+		}
+	}
+
+	return IsPending;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function issues a non-blocking copy of a data partition on
+ * 			a free PMC DMA. Copies in flight are completed first if no DMA
+ * 			is free or if the destination overlaps with one of them. An
+ * 			empty partition is only measured, after the copies in flight.
+ *
+ * @param	PdiPtr is pointer to XilPdi instance
+ * @param	DeviceCopy is pointer to the copy parameters of the partition
+ *
+ * @return
+ * 			- XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_PrtnCopyAsync(const XilPdi* PdiPtr,
+	const XLoader_DeviceCopy* DeviceCopy)
+{
+	int Status = XST_FAILURE;
+	const XilPdi_PrtnHdr *PrtnHdr = &(PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum]);
+	XLoader_PrtnXfer *Xfer = NULL;
+	XLoader_ImageMeasureInfo ImageMeasureInfo = {0U};
+	u64 DestEnd = DeviceCopy->DestAddr + DeviceCopy->Len;
+	u8 Drain = (u8)FALSE;
+	u32 Slot;
+
+	/**
+	 * - Nothing to copy, keep the measurements in partition order.
+	 */
+	if (DeviceCopy->Len == 0U) {
+		Status = XLoader_PrtnXferDrain();
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		ImageMeasureInfo.DataAddr = DeviceCopy->DestAddr;
+		ImageMeasureInfo.DataSize = PrtnHdr->UnEncDataWordLen << XPLMI_WORD_LEN_SHIFT;
+		ImageMeasureInfo.PcrInfo = PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].PcrInfo;
+		ImageMeasureInfo.Flags = XLOADER_MEASURE_UPDATE;
+		/* Update the data for measurement, only VersalNet */
+		Status = XLoader_DataMeasurement(&ImageMeasureInfo);
+		goto END;
+	}
+
+	for (Slot = 0U; Slot < XLOADER_PRTN_XFER_SLOTS; ++Slot) {
+		if (PrtnXfers[Slot].InFlight == (u8)FALSE) {
+			if (Xfer == NULL) {
+				Xfer = &PrtnXfers[Slot];
+			}
+		}
+		else if ((DeviceCopy->DestAddr < (PrtnXfers[Slot].DestAddr +
+				PrtnXfers[Slot].Len)) &&
+				(PrtnXfers[Slot].DestAddr < DestEnd)) {
+			Drain = (u8)TRUE;
+		}
+		else {
+			/* MISRA-C compliance */
+		}
+	}
+
+	if ((Xfer == NULL) || (Drain == (u8)TRUE)) {
+		Status = XLoader_PrtnXferDrain();
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Xfer = &PrtnXfers[0U];
+	}
+
+	Xfer->DmaFlags = (Xfer == &PrtnXfers[0U]) ? XPLMI_PMCDMA_1 : XPLMI_PMCDMA_0;
+	Xfer->DestAddr = DeviceCopy->DestAddr;
+	Xfer->Len = DeviceCopy->Len;
+	Xfer->PrtnNum = PdiPtr->PrtnNum;
+	Xfer->PcrInfo = PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].PcrInfo;
+	Xfer->MeasureLen = PrtnHdr->UnEncDataWordLen << XPLMI_WORD_LEN_SHIFT;
+	Xfer->StartTime = XPlmi_GetTimerValue();
+	/*
+	 * MetaHdr.DeviceCopy is switched back to the boot device copy after a
+	 * copy to memory partition, so the wait must use this one.
+	 */
+	Xfer->DeviceCopy = PdiPtr->MetaHdr.DeviceCopy;
+
+	Status = Xfer->DeviceCopy(DeviceCopy->SrcAddr,
+		DeviceCopy->DestAddr, DeviceCopy->Len,
+		Xfer->DmaFlags | XPLMI_DEVICE_COPY_STATE_INITIATE);
+	if (Status != XST_SUCCESS) {
+		XPlmi_Printf(DEBUG_GENERAL, "Device Copy Failed\n\r");
+		goto END;
+	}
+	Xfer->InFlight = (u8)TRUE;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits for all partition copies in flight and then
+ * 			updates their data measurement in issue order.
+ *
+ * @return
+ * 			- XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_PrtnXferDrain(void)
+{
+	int Status = XST_SUCCESS;
+	int SStatus;
+	XLoader_PrtnXfer *Xfer;
+	XLoader_ImageMeasureInfo ImageMeasureInfo = {0U};
+	XPlmi_PerfTime PerfTime;
+	u32 Slot;
+
+	/**
+	 * - Wait on both DMAs before measuring, the SHA engine needs PMCDMA0.
+	 */
+	for (Slot = 0U; Slot < XLOADER_PRTN_XFER_SLOTS; ++Slot) {
+		Xfer = &PrtnXfers[Slot];
+		if (Xfer->InFlight == (u8)FALSE) {
+			continue;
+		}
+		SStatus = Xfer->DeviceCopy(0U, 0U, 0U,
+			Xfer->DmaFlags | XPLMI_DEVICE_COPY_STATE_WAIT_DONE);
+		if ((SStatus != XST_SUCCESS) && (Status == XST_SUCCESS)) {
+			Status = SStatus;
+		}
+		XPlmi_MeasurePerfTime(Xfer->StartTime, &PerfTime);
+		XPlmi_Printf(DEBUG_PRINT_PERF,
+			" %u.%03u ms for Partition#: 0x%0x, Size: %u Bytes, DMA%u\n\r",
+			(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac, Xfer->PrtnNum,
+			Xfer->Len,
+			((Xfer->DmaFlags & XPLMI_PMCDMA_0) == XPLMI_PMCDMA_0) ? 0U : 1U);
+	}
+
+	for (Slot = 0U; Slot < XLOADER_PRTN_XFER_SLOTS; ++Slot) {
+		Xfer = &PrtnXfers[Slot];
+		if (Xfer->InFlight == (u8)FALSE) {
+			continue;
+		}
+		Xfer->InFlight = (u8)FALSE;
+		if (Status != XST_SUCCESS) {
+			continue;
+		}
+		ImageMeasureInfo.DataAddr = Xfer->DestAddr;
+		ImageMeasureInfo.DataSize = Xfer->MeasureLen;
+		ImageMeasureInfo.PcrInfo = Xfer->PcrInfo;
+		ImageMeasureInfo.Flags = XLOADER_MEASURE_UPDATE;
+		/* Update the data for measurement, only VersalNet */
+		Status = XLoader_DataMeasurement(&ImageMeasureInfo);
+	}
+
+	return Status;
+}
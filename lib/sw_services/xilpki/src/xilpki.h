@@ -172,6 +172,9 @@ int XPki_EcdsaGenerateSign(XPki_Instance *InstancePtr,
 			   XPki_EcdsaSign *Sign);
 int XPki_EcdsaVerifySign(XPki_Instance *InstancePtr,
 			 XPki_EcdsaVerifyInputData *VerifyParams);
+int XPki_EcdsaVerifySignBatch(XPki_Instance *InstancePtr,
+			      XPki_EcdsaVerifyInputData *VerifyParams,
+			      u32 Count, int *VerifyStatus);
 int XPki_EcdsaPointMulti(XPki_Instance *InstancePtr,
 			 XPki_EcdsaPointMultiInputData *PointMultiParams,
 			 XPki_EcdsaGpoint *Gpoint);
@@ -18,6 +18,7 @@
  * Ver   Who   Date      Changes
  * ----- ----  --------  ------------------------------------------------------
  * 1.0   Nava  12/05/22  Initial Release
+ *       agt   10/18/26  Added XPki_EcdsaVerifySignBatch
  *</pre>
  *
  *@note
@@ -40,6 +41,9 @@
 #define XPKI_EXP_CQ_STATUS		0x0U
 #define XPKI_EXP_CQ_VAL			0xB04E0001
 #define XPKI_DONE_POLL_COUNT		10000U
+#define XPKI_CQ_ENTRY_LEN_BYTES		0x8U
+#define XPKI_CQ_LEN_BYTES		0x1000U
+#define XPKI_RQ_PAGE_LEN_BYTES		0x400U
 
 #define XPKI_RQ_CFG_PERMISSIONS_SAFE	0x0U
 #define XPKI_RQ_CFG_PAGE_SIZE_1024	0x10U
@@ -65,6 +69,11 @@ static int XPki_LoadInputData_ModulusAdd(XPki_Instance *InstancePtr,
 					 u64 *EcdsaReqVal);
 static int XPki_Wait_For_Int_Done(u64 ExpVal);
 static void XPki_Init_Ecdsa(XPki_Instance *InstancePtr, u64 EcdsaReqVal);
+static void XPki_Config_Ecdsa(XPki_Instance *InstancePtr);
+static int XPki_Wait_For_CQ_Entry(UINTPTR CQEntry);
+static int XPki_EcdsaVerifySignQueued(XPki_Instance *InstancePtr,
+				      XPki_EcdsaVerifyInputData *VerifyParams,
+				      UINTPTR CQEntry);
 static int XPki_Check_Output_CompletionQueue(UINTPTR CQAddr);
 static int XPki_ValidateEcdsaGenerateSignParam(XPki_Instance *InstancePtr,
 					       XPki_EcdsaSignInputData *SignParams,
@@ -385,6 +394,142 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function is used to verify a batch of elliptic signatures.
+ *		The PKI is reset and its queues are configured once for the
+ *		batch, then each request is triggered on its own and completes
+ *		in the next completion queue entry. The request and completion
+ *		queue buffers are cleared once at the end of the batch. Every
+ *		request is processed even if an earlier one fails, so the time
+ *		taken does not depend on which signature is bad.
+ *
+ * @param	InstancePtr - Pointer to the XPki instance
+ * @param	VerifyParams - Array of Count XPki_EcdsaVerifyInputData
+ * @param	Count - Number of signatures in the batch
+ * @param	VerifyStatus - Array of Count entries updated with the status
+ *		of each signature verification
+ *
+ * @return
+ *	-	XST_SUCCESS - If all the signatures are verified successfully
+ *	-	XPKI_ECDSA_INVALID_PARAM - On invalid argument
+ *	-	XPKI_ECDSA_SIGN_VERIFY_ERR - If any of the signature
+ *		verifications failed, VerifyStatus holds the status of each one
+ *	-	XST_FAILURE - On failure
+ *
+ ******************************************************************************/
+int XPki_EcdsaVerifySignBatch(XPki_Instance *InstancePtr,
+			      XPki_EcdsaVerifyInputData *VerifyParams,
+			      u32 Count, int *VerifyStatus)
+{
+	volatile int Status = XST_FAILURE;
+	volatile int SStatus = XST_FAILURE;
+	volatile u32 NumFailed = 0U;
+	volatile u32 NumVerified = 0U;
+	UINTPTR CQEntry;
+	u32 Index;
+
+	if ((InstancePtr == NULL) || (VerifyParams == NULL) ||
+	    (VerifyStatus == NULL) || (Count == 0U)) {
+		Status = XPKI_ECDSA_INVALID_PARAM;
+		goto END;
+	}
+
+	XPki_Config_Ecdsa(InstancePtr);
+
+	for (Index = 0U; Index < Count; Index++) {
+		CQEntry = InstancePtr->CQAddr +
+			  ((Index * XPKI_CQ_ENTRY_LEN_BYTES) % XPKI_CQ_LEN_BYTES);
+		VerifyStatus[Index] = XST_FAILURE;
+		Status = XST_FAILURE;
+		Status = XPki_EcdsaVerifySignQueued(InstancePtr,
+						    &VerifyParams[Index], CQEntry);
+		VerifyStatus[Index] = Status;
+		if (Status == XST_SUCCESS) {
+			NumVerified++;
+		} else {
+			NumFailed++;
+		}
+	}
+
+	/* Both counts are checked so that one glitch cannot pass the batch */
+	Status = XPKI_ECDSA_SIGN_VERIFY_ERR;
+	if ((NumFailed == 0U) && (NumVerified == Count)) {
+		Status = XST_SUCCESS;
+	}
+
+	/* Clear the internal Memory */
+	SStatus = XST_FAILURE;
+	SStatus = Xil_SMemSet((u8 *)InstancePtr->RQInputAddr, XPKI_MAX_RQ_CFG_BUF_SIZE, 0U,
+			      XPKI_MAX_RQ_CFG_BUF_SIZE);
+	if ((SStatus != XST_SUCCESS) && (Status == XST_SUCCESS)) {
+		Status = SStatus;
+	}
+
+	SStatus = XST_FAILURE;
+	SStatus = Xil_SMemSet((u8 *)InstancePtr->CQAddr, XPKI_MAX_CQ_CFG_BUF_SIZE, 0U,
+			      XPKI_MAX_CQ_CFG_BUF_SIZE);
+	if ((SStatus != XST_SUCCESS) && (Status == XST_SUCCESS)) {
+		Status = SStatus;
+	}
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function is used to verify one elliptic signature of a
+ *		batch, on a PKI already configured by XPki_Config_Ecdsa().
+ *
+ * @param	InstancePtr - Pointer to the XPki instance
+ * @param	VerifyParams - Pointer to the XPki_EcdsaVerifyInputData
+ * @param	CQEntry - Completion queue entry of the request
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	XPKI_ECDSA_INVALID_PARAM - On invalid argument
+ *	-	XPKI_ECDSA_SIGN_VERIFY_ERR - On signaure verifucation failed.
+ *	-	XST_FAILURE - On failure
+ *
+ ******************************************************************************/
+static int XPki_EcdsaVerifySignQueued(XPki_Instance *InstancePtr,
+				      XPki_EcdsaVerifyInputData *VerifyParams,
+				      UINTPTR CQEntry)
+{
+	volatile int Status = XPKI_ECDSA_NON_SUPPORTED_CRV;
+	u64 EcdsaReqVal = 0;
+
+	XSECURE_TEMPORAL_CHECK(END, Status, XPki_ValidateEcdsaVerifySignParam,
+			       InstancePtr, VerifyParams);
+
+	Status = XST_FAILURE;
+	XSECURE_TEMPORAL_CHECK(END, Status, XPki_LoadInputData_EcdsaVerifySign,
+			       InstancePtr, VerifyParams, &EcdsaReqVal);
+
+	/* Drop the completion of an earlier request in this entry */
+	Status = XST_FAILURE;
+	XSECURE_TEMPORAL_CHECK(END, Status, Xil_SMemSet, (u8 *)CQEntry,
+			       XPKI_CQ_ENTRY_LEN_BYTES, 0U, XPKI_CQ_ENTRY_LEN_BYTES);
+
+	/* Flush the cache before transfer */
+	Xil_DCacheFlushRange((INTPTR)InstancePtr->RQInputAddr, XPKI_RQ_PAGE_LEN_BYTES);
+	Xil_DCacheFlushRange((INTPTR)CQEntry, XPKI_CQ_ENTRY_LEN_BYTES);
+	Xil_Out64(FPD_PKI_RQ_CTL_NEW_REQUEST, EcdsaReqVal);
+
+	Status = XST_FAILURE;
+	XSECURE_TEMPORAL_CHECK(END, Status, XPki_Wait_For_CQ_Entry, CQEntry);
+
+	Status = XST_FAILURE;
+	if ((Xil_In32(CQEntry) != XPKI_EXP_CQ_STATUS) ||
+	    (Xil_In32(CQEntry + 4U) != XPKI_EXP_CQ_VAL)) {
+		Status = XPKI_ECDSA_SIGN_VERIFY_ERR;
+	} else {
+		Status = XST_SUCCESS;
+	}
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function is used to perform the point multiplication for a
@@ -933,6 +1078,18 @@ END:
  *
  ******************************************************************************/
 static void XPki_Init_Ecdsa(XPki_Instance *InstancePtr, u64 EcdsaReqVal)
+{
+	XPki_Config_Ecdsa(InstancePtr);
+	Xil_Out64(FPD_PKI_RQ_CTL_NEW_REQUEST, EcdsaReqVal);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function is used to reset the PKI and configure its
+ *		request and completion queues.
+ *
+ ******************************************************************************/
+static void XPki_Config_Ecdsa(XPki_Instance *InstancePtr)
 {
 	XPki_SoftReset();
 	Xil_Out32(FPD_PKI_RQ_CFG_PERMISSIONS, XPKI_RQ_CFG_PERMISSIONS_SAFE);
@@ -952,7 +1109,6 @@ static void XPki_Init_Ecdsa(XPki_Instance *InstancePtr, u64 EcdsaReqVal)
 	Xil_DCacheFlushRange((INTPTR)InstancePtr->RQOutputAddr, XPKI_MAX_CQ_CFG_BUF_SIZE);
 
 	Xil_Out32(FPD_PKI_CQ_CTL_TRIGPOS, XPKI_CQ_CTL_TRIGPOS_VAL);
-	Xil_Out64(FPD_PKI_RQ_CTL_NEW_REQUEST, EcdsaReqVal);
 }
 
 /*****************************************************************************/
@@ -983,6 +1139,34 @@ static int XPki_Wait_For_Int_Done(u64 ExpVal)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function is used to wait for the PKI to write a
+ *		completion queue entry.
+ *
+ * @param	CQEntry - Completion queue entry, cleared before the request.
+ *
+ * @return
+ *	- 	XST_SUCCESS - On success
+ *	-	XPKI_DONE_STATUS_ERR - On failure
+ *
+ ******************************************************************************/
+static int XPki_Wait_For_CQ_Entry(UINTPTR CQEntry)
+{
+	volatile int Status = XPKI_DONE_STATUS_ERR;
+	u32 PollCount = XPKI_DONE_POLL_COUNT;
+
+	while (PollCount--) {
+		Xil_DCacheFlushRange((INTPTR)CQEntry, XPKI_CQ_ENTRY_LEN_BYTES);
+		if (Xil_In32(CQEntry + 4U) != 0U) {
+			Status = XST_SUCCESS;
+			break;
+		}
+	}
+
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief       This function is used to check the completion queue status.
@@ -152,6 +152,7 @@
  * | XPM_QID_CLOCK_GET_NUM_CLOCKS		| 12	| Both		| Get number of clocks			|
  * | XPM_QID_CLOCK_GET_MAX_DIVISOR		| 13	| Both		| Get max clock divisor			|
  * | XPM_QID_PLD_GET_PARENT			| 14	| Versal	| Get PLD parent			|
+ * | XPM_QID_PM_API_PROFILE			| 15	| Versal	| Get PM API latency profile		|
  *
  *****************************************************************************/
 
@@ -10,6 +10,7 @@
 #include "xplmi_ssit.h"
 #include "xpm_api.h"
 #include "xpm_api_plat.h"
+#include "xpm_prof.h"
 #include "xpm_defs.h"
 #include "xpm_psm_api.h"
 #include "xpm_pldomain.h"
@@ -110,7 +111,8 @@
 	(1ULL << (u64)XPM_QID_PINCTRL_GET_PIN_GROUPS) | \
 	(1ULL << (u64)XPM_QID_CLOCK_GET_NUM_CLOCKS) | \
 	(1ULL << (u64)XPM_QID_CLOCK_GET_MAX_DIVISOR) | \
-	(1ULL << (u64)XPM_QID_PLD_GET_PARENT))
+	(1ULL << (u64)XPM_QID_PLD_GET_PARENT) | \
+	XPM_PROF_QUERY_FEATURE)
 
 /****************************************************************************/
 /**
@@ -32,6 +32,7 @@
 #include "xpm_pll.h"
 #include "xpm_pmc.h"
 #include "xpm_pmcdomain.h"
+#include "xpm_prof.h"
 #include "xpm_psfpdomain.h"
 #include "xpm_pslpdomain.h"
 #include "xpm_psm.h"
@@ -339,6 +340,8 @@ static int XPm_ProcessCmd(XPlmi_Cmd * Cmd)
 		SubsystemId = PM_SUBSYS_PMC;
 	}
 
+	XPM_PROF_API_BEGIN(CmdId);
+
 	switch (CmdId) {
 	case PM_API(PM_SET_WAKEUP_SOURCE):
 		Status = XPm_SetWakeUpSource(SubsystemId, Pload[0], Pload[1], Pload[2]);
@@ -502,6 +505,8 @@ static int XPm_ProcessCmd(XPlmi_Cmd * Cmd)
 		break;
 	}
 
+	XPM_PROF_API_END(CmdId);
+
 	if (XST_SUCCESS == Status) {
 		Cmd->ResumeHandler = NULL;
 	} else {
@@ -852,6 +857,9 @@ XStatus XPm_Query(const u32 Qid, const u32 Arg1, const u32 Arg2,
 	case (u32)XPM_QID_CLOCK_GET_MAX_DIVISOR:
 		Status = XPmClock_GetMaxDivisor(Arg1, Arg2, Output);
 		break;
+	case (u32)XPM_QID_PM_API_PROFILE:
+		Status = XPmProf_Query(Arg1, Arg2, Output);
+		break;
 	default:
 		Status = XPm_PlatQuery(Qid, Arg1, Arg2, Arg3, Output);
 		break;
@@ -11,6 +11,7 @@
 #include "xpm_pll.h"
 #include "xpm_device.h"
 #include "xpm_debug.h"
+#include "xpm_prof.h"
 
 /* Query related defines */
 #define CLK_QUERY_NAME_LEN		(MAX_NAME_BYTES)
@@ -547,6 +548,8 @@ XStatus XPmClock_Request(const XPm_ClockHandle *ClkHandle)
 	XPm_ClockNode *Clk;
 	u32 ClkId;
 
+	XPM_PROF_SPAN_BEGIN(XPM_PROF_SPAN_CLOCK);
+
 	if (NULL == ClkHandle) {
 		Status = XST_SUCCESS;
 		goto done;
@@ -572,6 +575,7 @@ XStatus XPmClock_Request(const XPm_ClockHandle *ClkHandle)
 	Status = XST_SUCCESS;
 
 done:
+	XPM_PROF_SPAN_END(XPM_PROF_SPAN_CLOCK);
 	return Status;
 }
 
@@ -613,6 +617,8 @@ XStatus XPmClock_Release(const XPm_ClockHandle *ClkHandle)
 	XPm_ClockNode *Clk;
 	u32 ClkId;
 
+	XPM_PROF_SPAN_BEGIN(XPM_PROF_SPAN_CLOCK);
+
 	if (NULL == ClkHandle) {
 		Status = XST_SUCCESS;
 		goto done;
@@ -637,6 +643,7 @@ XStatus XPmClock_Release(const XPm_ClockHandle *ClkHandle)
 	Status = XST_SUCCESS;
 
 done:
+	XPM_PROF_SPAN_END(XPM_PROF_SPAN_CLOCK);
 	return Status;
 }
 
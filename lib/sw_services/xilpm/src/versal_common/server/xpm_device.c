@@ -19,6 +19,7 @@
 #include "xpm_requirement.h"
 #include "xpm_debug.h"
 #include "xpm_pldevice.h"
+#include "xpm_prof.h"
 
 static const char *PmDevStates[] = {
 	"UNUSED",
@@ -179,17 +180,7 @@ static XStatus SetAieDeviceNode(u32 Id, XPm_Device *Device)
 
 static XPm_Requirement *FindReqm(const XPm_Device *Device, const XPm_Subsystem *Subsystem)
 {
-	XPm_Requirement *Reqm = NULL;
-
-	Reqm = Device->Requirements;
-	while (NULL != Reqm) {
-		if (Reqm->Subsystem == Subsystem) {
-			break;
-		}
-		Reqm = Reqm->NextSubsystem;
-	}
-
-	return Reqm;
+	return XPmRequirement_Find(Device, Subsystem);
 }
 
 struct XPm_Reqm *XPmDevice_FindRequirement(const u32 DeviceId, const u32 SubsystemId)
@@ -1841,6 +1832,8 @@ XStatus XPmDevice_ChangeState(XPm_Device *Device, const u32 NextState)
 	u32 OldState = Device->Node.State;
 	u32 Trans;
 
+	XPM_PROF_SPAN_BEGIN(XPM_PROF_SPAN_DEVICE);
+
 	if (0U == Fsm->TransCnt) {
 		/* Device's FSM has no transitions when it has only one state */
 		Status = XST_SUCCESS;
@@ -1872,6 +1865,7 @@ XStatus XPmDevice_ChangeState(XPm_Device *Device, const u32 NextState)
 	}
 
 done:
+	XPM_PROF_SPAN_END(XPM_PROF_SPAN_DEVICE);
 	return Status;
 }
 
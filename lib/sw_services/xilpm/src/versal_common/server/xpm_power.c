@@ -12,6 +12,7 @@
 #include "xpm_psm.h"
 #include "xpm_requirement.h"
 #include "xpm_debug.h"
+#include "xpm_prof.h"
 
 static XPm_Power *PmPowers[XPM_NODEIDX_POWER_MAX];
 static u32 PmNumPowers;
@@ -374,6 +375,8 @@ static XStatus PowerEvent(XPm_Node *Node, u32 Event)
 	PmDbg("[IN] Id:0x%x, UseCount:%d, State=%x, Event=%x\r\n",
 			Node->Id, Power->UseCount, Node->State, Event);
 
+	XPM_PROF_SPAN_BEGIN(XPM_PROF_SPAN_POWER);
+
 	switch (Node->State)
 	{
 		case (u8)XPM_POWER_STATE_STANDBY:
@@ -400,6 +403,8 @@ static XStatus PowerEvent(XPm_Node *Node, u32 Event)
 			break;
 	}
 
+	XPM_PROF_SPAN_END(XPM_PROF_SPAN_POWER);
+
 	PmDbg("[OUT] Id:0x%x, UseCount:%d, State=%x, Event=%x\r\n",
 			Node->Id, Power->UseCount, Node->State, Event);
 
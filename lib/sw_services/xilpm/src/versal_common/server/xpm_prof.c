@@ -0,0 +1,248 @@
+/******************************************************************************
+* Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+#include "xplmi_proc.h"
+#include "xpm_common.h"
+#include "xpm_prof.h"
+
+#ifdef XILPM_PROFILE_EN
+
+#define XPM_PROF_MAX_U32	(0xFFFFFFFFU)
+#define XPM_PROF_MAX_U16	(0xFFFFU)
+#define XPM_PROF_MAX_U8		(0xFFU)
+
+/**
+ * Latency record of one PM API
+ */
+typedef struct {
+	u32 Count; /**< Number of completed calls */
+	u32 TotalUs; /**< Accumulated latency */
+	u32 MaxUs; /**< Worst case latency */
+	u32 SpanUs[XPM_PROF_SPAN_MAX]; /**< Time spent per span category */
+	u16 Hist[XPM_PROF_HIST_BUCKETS]; /**< Log2 latency histogram */
+} XPm_ProfApi;
+
+static XPm_ProfApi ProfApis[PM_API_MAX];
+
+/* State of the API call in progress; PM APIs are not re-entered */
+static u64 ApiStart;
+static u32 CurApiId = (u32)PM_API_MAX;
+static u64 SpanStart[XPM_PROF_SPAN_MAX];
+static u8 SpanDepth[XPM_PROF_SPAN_MAX];
+
+/****************************************************************************/
+/**
+ * @brief	Convert elapsed PIT ticks into microseconds
+ *
+ * @param Start	Timer value at the start of the interval
+ *
+ * @return	Elapsed time in microseconds, saturated to 32 bits
+ *
+ * @note	The PMC PIT counts down, so the start value is the larger one.
+ *
+ ****************************************************************************/
+static u32 XPmProf_ElapsedUs(u64 Start)
+{
+	u64 Ticks = Start - XPlmi_GetTimerValue();
+	u32 IroFreqMHz = *XPlmi_GetPmcIroFreq() / XPLMI_MEGA;
+	u64 Us = Ticks / (u64)IroFreqMHz;
+
+	return (Us > (u64)XPM_PROF_MAX_U32) ? XPM_PROF_MAX_U32 : (u32)Us;
+}
+
+static u32 XPmProf_SatAdd(u32 Acc, u32 Val)
+{
+	return ((XPM_PROF_MAX_U32 - Acc) < Val) ? XPM_PROF_MAX_U32 : (Acc + Val);
+}
+
+/****************************************************************************/
+/**
+ * @brief	Mark the start of a PM API call
+ *
+ * @param ApiId	ID of the PM API being processed
+ *
+ ****************************************************************************/
+void XPmProf_ApiBegin(u32 ApiId)
+{
+	u32 Idx;
+
+	if ((u32)PM_API_MAX <= ApiId) {
+		goto done;
+	}
+
+	for (Idx = 0U; Idx < (u32)XPM_PROF_SPAN_MAX; Idx++) {
+		SpanDepth[Idx] = 0U;
+	}
+	CurApiId = ApiId;
+	ApiStart = XPlmi_GetTimerValue();
+
+done:
+	return;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Mark the end of a PM API call and account its latency
+ *
+ * @param ApiId	ID of the PM API being processed
+ *
+ ****************************************************************************/
+void XPmProf_ApiEnd(u32 ApiId)
+{
+	XPm_ProfApi *Api;
+	u32 Us;
+	u32 Bucket = 0U;
+
+	if ((ApiId != CurApiId) || ((u32)PM_API_MAX <= ApiId)) {
+		goto done;
+	}
+
+	Us = XPmProf_ElapsedUs(ApiStart);
+	Api = &ProfApis[ApiId];
+	Api->Count++;
+	Api->TotalUs = XPmProf_SatAdd(Api->TotalUs, Us);
+	if (Us > Api->MaxUs) {
+		Api->MaxUs = Us;
+	}
+
+	while (((Us >> 1U) != 0U) && (Bucket < (XPM_PROF_HIST_BUCKETS - 1U))) {
+		Us >>= 1U;
+		Bucket++;
+	}
+	if (XPM_PROF_MAX_U16 != Api->Hist[Bucket]) {
+		Api->Hist[Bucket]++;
+	}
+
+	CurApiId = (u32)PM_API_MAX;
+
+done:
+	return;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Enter a clock, power or device graph span
+ *
+ * @param Span	Span category
+ *
+ * @note	Spans of one category nest recursively along the graph; only
+ *		the outermost one is timed so that time is not counted twice.
+ *
+ ****************************************************************************/
+void XPmProf_SpanBegin(XPm_ProfSpan Span)
+{
+	if (((u32)PM_API_MAX == CurApiId) || (XPM_PROF_SPAN_MAX <= Span)) {
+		goto done;
+	}
+
+	if (0U == SpanDepth[Span]) {
+		SpanStart[Span] = XPlmi_GetTimerValue();
+	}
+	if (XPM_PROF_MAX_U8 != SpanDepth[Span]) {
+		SpanDepth[Span]++;
+	}
+
+done:
+	return;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Leave a clock, power or device graph span
+ *
+ * @param Span	Span category
+ *
+ ****************************************************************************/
+void XPmProf_SpanEnd(XPm_ProfSpan Span)
+{
+	XPm_ProfApi *Api;
+
+	if (((u32)PM_API_MAX == CurApiId) || (XPM_PROF_SPAN_MAX <= Span) ||
+	    (0U == SpanDepth[Span])) {
+		goto done;
+	}
+
+	SpanDepth[Span]--;
+	if (0U == SpanDepth[Span]) {
+		Api = &ProfApis[CurApiId];
+		Api->SpanUs[Span] = XPmProf_SatAdd(Api->SpanUs[Span],
+						   XPmProf_ElapsedUs(SpanStart[Span]));
+	}
+
+done:
+	return;
+}
+
+#endif /* XILPM_PROFILE_EN */
+
+/****************************************************************************/
+/**
+ * @brief	Read back the latency profile of a PM API
+ *
+ * @param ApiId		ID of the PM API
+ * @param Selector	XPM_PROF_SEL_* selector of the data to return
+ * @param Output	Three words of profile data
+ *
+ * @return	XST_SUCCESS if successful, XST_NO_FEATURE if profiling is not
+ *		compiled in, else XST_INVALID_PARAM
+ *
+ ****************************************************************************/
+XStatus XPmProf_Query(u32 ApiId, u32 Selector, u32 *Output)
+{
+	XStatus Status = XST_NO_FEATURE;
+#ifdef XILPM_PROFILE_EN
+	const XPm_ProfApi *Api;
+	u32 Idx;
+	u32 Bucket;
+
+	if (XPM_PROF_SEL_RESET == Selector) {
+		Status = Xil_SMemSet(ProfApis, sizeof(ProfApis), 0U,
+				     sizeof(ProfApis));
+		goto done;
+	}
+
+	if ((u32)PM_API_MAX <= ApiId) {
+		Status = XST_INVALID_PARAM;
+		goto done;
+	}
+
+	Api = &ProfApis[ApiId];
+	Status = XST_SUCCESS;
+	switch (Selector) {
+	case XPM_PROF_SEL_SUMMARY:
+		Output[0] = Api->Count;
+		Output[1] = Api->TotalUs;
+		Output[2] = Api->MaxUs;
+		break;
+	case XPM_PROF_SEL_SPANS:
+		Output[0] = Api->SpanUs[XPM_PROF_SPAN_CLOCK];
+		Output[1] = Api->SpanUs[XPM_PROF_SPAN_POWER];
+		Output[2] = Api->SpanUs[XPM_PROF_SPAN_DEVICE];
+		break;
+	default:
+		if (XPM_PROF_SEL_HIST > Selector) {
+			Status = XST_INVALID_PARAM;
+			break;
+		}
+		Bucket = (Selector - XPM_PROF_SEL_HIST) * 3U;
+		if (XPM_PROF_HIST_BUCKETS <= Bucket) {
+			Status = XST_INVALID_PARAM;
+			break;
+		}
+		for (Idx = 0U; Idx < 3U; Idx++) {
+			Output[Idx] = ((Bucket + Idx) < XPM_PROF_HIST_BUCKETS) ?
+				      (u32)Api->Hist[Bucket + Idx] : 0U;
+		}
+		break;
+	}
+
+done:
+#else
+	(void)ApiId;
+	(void)Selector;
+	(void)Output;
+#endif
+	return Status;
+}
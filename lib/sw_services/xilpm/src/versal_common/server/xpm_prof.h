@@ -0,0 +1,67 @@
+/******************************************************************************
+* Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+#ifndef XPM_PROF_H_
+#define XPM_PROF_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xpm_defs.h"
+
+/*
+ * PM API latency profiling is compiled in only when XILPM_PROFILE_EN is
+ * defined. Collected data is read back through PM_QUERY_DATA with
+ * XPM_QID_PM_API_PROFILE:
+ *	Arg1 - PM API ID
+ *	Arg2 - XPM_PROF_SEL_* selector
+ */
+
+/* Profile query selectors */
+#define XPM_PROF_SEL_SUMMARY	(0U) /**< Count, total and max latency (us) */
+#define XPM_PROF_SEL_SPANS	(1U) /**< Clock, power and device time (us) */
+#define XPM_PROF_SEL_RESET	(2U) /**< Clear all collected data */
+#define XPM_PROF_SEL_HIST	(3U) /**< Histogram buckets, 3 per selector */
+
+/* Latency histogram buckets, bucket N counts calls below 2^(N+1) us */
+#define XPM_PROF_HIST_BUCKETS	(12U)
+
+/* Span categories for graph traversal inside an API */
+typedef enum {
+	XPM_PROF_SPAN_CLOCK,
+	XPM_PROF_SPAN_POWER,
+	XPM_PROF_SPAN_DEVICE,
+	XPM_PROF_SPAN_MAX,
+} XPm_ProfSpan;
+
+#ifdef XILPM_PROFILE_EN
+#define XPM_PROF_QUERY_FEATURE	(1ULL << (u64)XPM_QID_PM_API_PROFILE)
+#define XPM_PROF_API_BEGIN(ApiId)	XPmProf_ApiBegin(ApiId)
+#define XPM_PROF_API_END(ApiId)		XPmProf_ApiEnd(ApiId)
+#define XPM_PROF_SPAN_BEGIN(Span)	XPmProf_SpanBegin(Span)
+#define XPM_PROF_SPAN_END(Span)		XPmProf_SpanEnd(Span)
+
+void XPmProf_ApiBegin(u32 ApiId);
+void XPmProf_ApiEnd(u32 ApiId);
+void XPmProf_SpanBegin(XPm_ProfSpan Span);
+void XPmProf_SpanEnd(XPm_ProfSpan Span);
+#else
+#define XPM_PROF_QUERY_FEATURE	(0ULL)
+#define XPM_PROF_API_BEGIN(ApiId)
+#define XPM_PROF_API_END(ApiId)
+#define XPM_PROF_SPAN_BEGIN(Span)
+#define XPM_PROF_SPAN_END(Span)
+#endif
+
+XStatus XPmProf_Query(u32 ApiId, u32 Selector, u32 *Output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XPM_PROF_H_ */
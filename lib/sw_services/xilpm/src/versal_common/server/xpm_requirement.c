@@ -9,6 +9,88 @@
 #include "xpm_power.h"
 #include "xpm_api.h"
 
+/*
+ * Open-addressed index of all requirements keyed by (subsystem, device).
+ * Lookups from the device request paths would otherwise walk the device's
+ * requirement list, which grows with the number of subsystems. Requirements
+ * are never removed, so the index holds no tombstones and a probe ends at
+ * the first empty slot.
+ */
+static XPm_Requirement *ReqmIndex[XPM_REQM_INDEX_SIZE];
+static u8 ReqmIndexOverflow;
+
+static u32 XPmRequirement_Hash(const XPm_Subsystem *Subsystem,
+			       const XPm_Device *Device)
+{
+	u32 Key = Device->Node.Id ^ (NODEINDEX(Subsystem->Id) << 24U);
+
+	/* Fibonacci hashing: keep the upper bits of the product */
+	return (Key * 0x9E3779B1U) >> (32U - XPM_REQM_INDEX_BITS);
+}
+
+static void XPmRequirement_IndexAdd(XPm_Requirement *Reqm)
+{
+	u32 Slot = XPmRequirement_Hash(Reqm->Subsystem, Reqm->Device);
+	u32 Probe;
+
+	for (Probe = 0U; Probe < XPM_REQM_INDEX_MAX_PROBE; Probe++) {
+		if (NULL == ReqmIndex[Slot]) {
+			ReqmIndex[Slot] = Reqm;
+			goto done;
+		}
+		Slot = (Slot + 1U) & (XPM_REQM_INDEX_SIZE - 1U);
+	}
+
+	/* No slot close enough, lookups have to fall back to the list walk */
+	ReqmIndexOverflow = 1U;
+
+done:
+	return;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Find the requirement imposed by a subsystem on a device
+ *
+ * @param Device	Device whose requirement is searched
+ * @param Subsystem	Subsystem which imposes the requirement
+ *
+ * @return	Pointer to the requirement or NULL if there is none
+ *
+ ****************************************************************************/
+XPm_Requirement *XPmRequirement_Find(const XPm_Device *Device,
+				     const XPm_Subsystem *Subsystem)
+{
+	XPm_Requirement *Reqm = NULL;
+	u32 Slot = XPmRequirement_Hash(Subsystem, Device);
+	u32 Probe;
+
+	for (Probe = 0U; Probe < XPM_REQM_INDEX_MAX_PROBE; Probe++) {
+		Reqm = ReqmIndex[Slot];
+		if ((NULL == Reqm) || ((Reqm->Subsystem == Subsystem) &&
+				       (Reqm->Device == Device))) {
+			break;
+		}
+		Slot = (Slot + 1U) & (XPM_REQM_INDEX_SIZE - 1U);
+	}
+
+	if (XPM_REQM_INDEX_MAX_PROBE == Probe) {
+		Reqm = NULL;
+	}
+
+	if ((NULL == Reqm) && (0U != ReqmIndexOverflow)) {
+		Reqm = Device->Requirements;
+		while (NULL != Reqm) {
+			if (Reqm->Subsystem == Subsystem) {
+				break;
+			}
+			Reqm = Reqm->NextSubsystem;
+		}
+	}
+
+	return Reqm;
+}
+
 static void XPmRequirement_Init(XPm_Requirement *Reqm, XPm_Subsystem *Subsystem,
 				XPm_Device *Device, u32 Flags,
 				u32 PreallocCaps, u32 PreallocQoS)
@@ -35,6 +117,8 @@ static void XPmRequirement_Init(XPm_Requirement *Reqm, XPm_Subsystem *Subsystem,
 	Reqm->Next.Capabilities = XPM_MIN_CAPABILITY;
 	Reqm->Next.Latency = XPM_MAX_LATENCY;
 	Reqm->Next.QoS = XPM_MAX_QOS;
+
+	XPmRequirement_IndexAdd(Reqm);
 }
 
 XStatus XPmRequirement_Add(XPm_Subsystem *Subsystem, XPm_Device *Device,
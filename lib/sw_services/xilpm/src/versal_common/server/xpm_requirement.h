@@ -22,6 +22,14 @@ typedef struct XPm_Reqm XPm_Requirement;
 #define REQ_INFO_LATENCY_BIT_FIELD_SIZE		21
 #define REQ_INFO_RESERVED_BIT_FIELD_SIZE	7
 
+/* Number of slots in the (subsystem, device) requirement index */
+#ifndef XPM_REQM_INDEX_BITS
+#define XPM_REQM_INDEX_BITS	(9U)
+#endif
+#define XPM_REQM_INDEX_SIZE	((u32)1U << XPM_REQM_INDEX_BITS)
+/* Longest probe sequence in the requirement index */
+#define XPM_REQM_INDEX_MAX_PROBE	(8U)
+
 /**
  * Specific requirement information.
  */
@@ -110,6 +118,8 @@ struct XPm_Reqm {
 
 XStatus XPmRequirement_Add(XPm_Subsystem *Subsystem, XPm_Device *Device,
 			   u32 Flags, u32 PreallocCaps, u32 PreallocQoS);
+XPm_Requirement *XPmRequirement_Find(const XPm_Device *Device,
+				     const XPm_Subsystem *Subsystem);
 void XPm_RequiremntUpdate(XPm_Requirement *Reqm);
 XStatus XPmRequirement_Release(XPm_Requirement *Reqm, XPm_ReleaseScope Scope);
 void XPmRequirement_Clear(XPm_Requirement* Reqm);
@@ -12,6 +12,7 @@
 #include "xplmi_sysmon.h"
 #include "xplmi_util.h"
 #include "xpm_api_plat.h"
+#include "xpm_prof.h"
 #include "xpm_bisr.h"
 #include "xpm_device.h"
 #include "xpm_common.h"
@@ -89,7 +90,8 @@
 	(1ULL << (u64)XPM_QID_CLOCK_GET_ATTRIBUTES) | \
 	(1ULL << (u64)XPM_QID_CLOCK_GET_NUM_CLOCKS) | \
 	(1ULL << (u64)XPM_QID_CLOCK_GET_MAX_DIVISOR) | \
-	(1ULL << (u64)XPM_QID_PLD_GET_PARENT))
+	(1ULL << (u64)XPM_QID_PLD_GET_PARENT) | \
+	XPM_PROF_QUERY_FEATURE)
 
 XStatus XPm_PlatAddDevRequirement(XPm_Subsystem *Subsystem, u32 DeviceId,
 				     u32 ReqFlags, const u32 *Args, u32 NumArgs)
@@ -47,6 +47,8 @@
 * 5.0   kpt  07/24/22 Moved XSecure_EllipticKat into xsecure_kat.c
 *       dc   08/26/22 Removed initializations of arrays
 * 5.1   dc   03/30/23 Added support to accept the data in either big/little endian.
+*       agt  10/18/26 Added XSecure_EllipticVerifySignBatch_64Bit to verify
+*                     multiple signatures with a single engine setup
 *
 * </pre>
 *
@@ -79,6 +81,9 @@
 EcdsaCrvInfo* XSecure_EllipticGetCrvData(XSecure_EllipticCrvTyp CrvTyp);
 static void XSecure_PutData(const u32 Size, u8 *Dst, const u64 SrcAddr);
 static void XSecure_GetData(const u32 Size, const u8 *Src, const u64 DstAddr);
+static int XSecure_EllipticVerifySignCore(XSecure_EllipticCrvTyp CrvType,
+	EcdsaCrvInfo *Crv, XSecure_EllipticHashData *HashInfo,
+	XSecure_EllipticKeyAddr *KeyAddr, XSecure_EllipticSignAddr *SignAddr);
 
 /************************** Variable Definitions *****************************/
 
@@ -526,21 +531,7 @@ int XSecure_EllipticVerifySign_64Bit(XSecure_EllipticCrvTyp CrvType,
 	XSecure_EllipticSignAddr *SignAddr)
 {
 	volatile int Status = (int)XSECURE_ELLIPTIC_NON_SUPPORTED_CRV;
-	volatile int VerifyStatus = XST_FAILURE;
-	volatile int VerifyStatusTmp = XST_FAILURE;
 	EcdsaCrvInfo *Crv = NULL;
-	u8 PaddedHash[XSECURE_ECC_P521_SIZE_IN_BYTES];
-	volatile u32 HashLenTmp = 0xFFFFFFFFU;
-	u8 PubKey[XSECURE_ECC_P521_SIZE_IN_BYTES +
-		XSECURE_ECDSA_P521_ALIGN_BYTES +
-		XSECURE_ECC_P521_SIZE_IN_BYTES];
-	u8 Signature[XSECURE_ECC_P521_SIZE_IN_BYTES +
-		XSECURE_ECDSA_P521_ALIGN_BYTES +
-		XSECURE_ECC_P521_SIZE_IN_BYTES];
-	EcdsaKey Key;
-	EcdsaSign Sign;
-	u32 OffSet = 0U;
-	u32 Size = 0U;
 
 	Status = XSecure_CryptoCheck();
 	if (Status != XST_SUCCESS) {
@@ -553,88 +544,108 @@ int XSecure_EllipticVerifySign_64Bit(XSecure_EllipticCrvTyp CrvType,
 		goto END;
 	}
 
-	HashLenTmp = HashInfo->Len;
-	if ((HashInfo->Len > XSECURE_ECC_P521_SIZE_IN_BYTES) ||
-		(HashLenTmp > XSECURE_ECC_P521_SIZE_IN_BYTES)) {
-		Status = (int)XSECURE_ELLIPTIC_INVALID_PARAM;
-		goto END;
-	}
+	XSecure_ReleaseReset(XSECURE_ECDSA_RSA_BASEADDR,
+		XSECURE_ECDSA_RSA_RESET_OFFSET);
 
-	Status = Xil_SMemSet(PaddedHash, XSECURE_ECC_P521_SIZE_IN_BYTES,
-				0U, XSECURE_ECC_P521_SIZE_IN_BYTES);
-	if (Status != XST_SUCCESS) {
-		goto END;
+	Crv = XSecure_EllipticGetCrvData(CrvType);
+	if (Crv != NULL) {
+		Status = XSecure_EllipticVerifySignCore(CrvType, Crv, HashInfo,
+			KeyAddr, SignAddr);
 	}
 
-	/* Store Pub key(Qx,Qy) and Sign(SignR, SignS) to local buffers */
-	if (CrvType == XSECURE_ECC_NIST_P521) {
-		Size = XSECURE_ECC_P521_SIZE_IN_BYTES;
-		OffSet = Size + XSECURE_ECDSA_P521_ALIGN_BYTES;
-	} else {
-		Size = XSECURE_ECC_P384_SIZE_IN_BYTES;
-		OffSet = Size;
-	}
-	XSecure_PutData(Size, (u8 *)PubKey, KeyAddr->Qx);
-	XSecure_PutData(Size, (u8 *)(PubKey + OffSet), KeyAddr->Qy);
+END:
+	XSecure_SetReset(XSECURE_ECDSA_RSA_BASEADDR,
+		XSECURE_ECDSA_RSA_RESET_OFFSET);
+	return Status;
+}
 
-	XSecure_PutData(Size, (u8 *)Signature, SignAddr->SignR);
-	XSecure_PutData(Size, (u8 *)(Signature + OffSet),
-			SignAddr->SignS);
+/*****************************************************************************/
+/**
+ * @brief	This function verifies a batch of signatures on the same curve
+ *		where data is located at 64-bit address. The crypto check, curve
+ *		lookup and ECDSA engine reset release are done once for the whole
+ *		batch. Every entry is verified even if an earlier one fails, so
+ *		the time taken does not depend on which entry is bad.
+ *
+ * @param	CrvType - Type of elliptic curve
+ * @param	Count - Number of signatures in the batch
+ * @param	HashInfo - Array of Count hash descriptors
+ * @param	KeyAddr  - Array of Count public key addresses
+ * @param	SignAddr - Array of Count signature addresses
+ * @param	VerifyStatus - Array of Count entries updated with the
+ *		verification status of each signature
+ *
+ * @return
+ *	-	XST_SUCCESS - If all the signatures are verified successfully
+ *	-	XSECURE_ELLIPTIC_INVALID_PARAM - On invalid argument
+ *	-	XSECURE_ELLIPTIC_BAD_SIGN - When any of the signatures is bad,
+ *		VerifyStatus holds the error code of each entry
+ *	-	XST_FAILURE - On failure
+ *
+ *****************************************************************************/
+int XSecure_EllipticVerifySignBatch_64Bit(XSecure_EllipticCrvTyp CrvType,
+	u32 Count, XSecure_EllipticHashData *HashInfo,
+	XSecure_EllipticKeyAddr *KeyAddr, XSecure_EllipticSignAddr *SignAddr,
+	int *VerifyStatus)
+{
+	volatile int Status = (int)XSECURE_ELLIPTIC_NON_SUPPORTED_CRV;
+	EcdsaCrvInfo *Crv = NULL;
+	volatile u32 NumFailed = 0U;
+	volatile u32 NumVerified = 0U;
+	u32 Index;
 
+	if ((Count == 0U) || (HashInfo == NULL) || (KeyAddr == NULL) ||
+		(SignAddr == NULL) || (VerifyStatus == NULL)) {
+		Status = (int)XSECURE_ELLIPTIC_INVALID_PARAM;
+		goto RET;
+	}
 
-	/* Store Hash to local buffer */
-	XSecure_PutData(HashInfo->Len, (u8 *)PaddedHash, HashInfo->Addr);
+	for (Index = 0U; Index < Count; Index++) {
+		VerifyStatus[Index] = XST_FAILURE;
+	}
 
-	Key.Qx = (u8 *)(UINTPTR)PubKey;
-	Key.Qy = (u8 *)(UINTPTR)(PubKey + OffSet);
+	Status = XSecure_CryptoCheck();
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
 
-	Sign.r = (u8 *)(UINTPTR)Signature;
-	Sign.s = (u8 *)(UINTPTR)(Signature + OffSet);
+	Status = XST_FAILURE;
+	if ((CrvType != XSECURE_ECC_NIST_P384) && (CrvType != XSECURE_ECC_NIST_P521)) {
+		Status = (int)XSECURE_ELLIPTIC_INVALID_PARAM;
+		goto END;
+	}
 
 	XSecure_ReleaseReset(XSECURE_ECDSA_RSA_BASEADDR,
 		XSECURE_ECDSA_RSA_RESET_OFFSET);
 
 	Crv = XSecure_EllipticGetCrvData(CrvType);
-	if(Crv != NULL) {
-		XSECURE_TEMPORAL_IMPL(VerifyStatus, VerifyStatusTmp, Ecdsa_VerifySign,
-			Crv, PaddedHash, Crv->Bits, (EcdsaKey *)&Key, (EcdsaSign *)&Sign);
+	if (Crv == NULL) {
+		goto END;
+	}
 
-		if ((ELLIPTIC_BAD_SIGN == VerifyStatus) ||
-			(ELLIPTIC_BAD_SIGN == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_BAD_SIGN;
-		}
-		else if ((ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN == VerifyStatus) ||
-			(ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN;
-		}
-		else if ((ELLIPTIC_VER_SIGN_R_ZERO == VerifyStatus) ||
-			(ELLIPTIC_VER_SIGN_R_ZERO == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_VER_SIGN_R_ZERO;
-		}
-		else if ((ELLIPTIC_VER_SIGN_S_ZERO == VerifyStatus) ||
-			(ELLIPTIC_VER_SIGN_S_ZERO == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_VER_SIGN_S_ZERO;
-		}
-		else if ((ELLIPTIC_VER_SIGN_R_ORDER_ERROR == VerifyStatus) ||
-			(ELLIPTIC_VER_SIGN_R_ORDER_ERROR == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_VER_SIGN_R_ORDER_ERROR;
-		}
-		else if ((ELLIPTIC_VER_SIGN_S_ORDER_ERROR == VerifyStatus) ||
-			(ELLIPTIC_VER_SIGN_S_ORDER_ERROR == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_VER_SIGN_S_ORDER_ERROR;
-		}
-		else if ((ELLIPTIC_SUCCESS != VerifyStatus) ||
-			(ELLIPTIC_SUCCESS != VerifyStatusTmp)) {
-			Status = XST_FAILURE;
+	for (Index = 0U; Index < Count; Index++) {
+		VerifyStatus[Index] = XSecure_EllipticVerifySignCore(CrvType, Crv,
+			&HashInfo[Index], &KeyAddr[Index], &SignAddr[Index]);
+		if (VerifyStatus[Index] == XST_SUCCESS) {
+			NumVerified++;
 		}
 		else {
-			Status = XST_SUCCESS;
+			NumFailed++;
 		}
 	}
 
+	/* Both counters are checked, so one glitched test cannot pass a batch */
+	if ((NumFailed == 0U) && (NumVerified == Count)) {
+		Status = XST_SUCCESS;
+	}
+	else {
+		Status = (int)XSECURE_ELLIPTIC_BAD_SIGN;
+	}
+
 END:
 	XSecure_SetReset(XSECURE_ECDSA_RSA_BASEADDR,
 		XSECURE_ECDSA_RSA_RESET_OFFSET);
+RET:
 	return Status;
 }
 
@@ -679,6 +690,120 @@ int XSecure_EllipticVerifySign(XSecure_EllipticCrvTyp CrvType, const u8 *Hash,
 			(XSecure_EllipticSignAddr *) &SignAddr);
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function verifies the signature for a given hash, key and
+ *		curve with the ECDSA engine already out of reset
+ *
+ * @param	CrvType - Type of elliptic curve
+ * @param	Crv - Curve information of CrvType
+ * @param	HashInfo - Pointer to Hash Data i.e. Hash Address and length
+ * @param	KeyAddr  - Pointer to public key address
+ * @param	SignAddr - Pointer to signature address
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	Error code as returned by XSecure_EllipticVerifySign_64Bit
+ *		on failure
+ *
+ *****************************************************************************/
+static int XSecure_EllipticVerifySignCore(XSecure_EllipticCrvTyp CrvType,
+	EcdsaCrvInfo *Crv, XSecure_EllipticHashData *HashInfo,
+	XSecure_EllipticKeyAddr *KeyAddr, XSecure_EllipticSignAddr *SignAddr)
+{
+	volatile int Status = XST_FAILURE;
+	volatile int VerifyStatus = XST_FAILURE;
+	volatile int VerifyStatusTmp = XST_FAILURE;
+	u8 PaddedHash[XSECURE_ECC_P521_SIZE_IN_BYTES];
+	volatile u32 HashLenTmp = 0xFFFFFFFFU;
+	u8 PubKey[XSECURE_ECC_P521_SIZE_IN_BYTES +
+		XSECURE_ECDSA_P521_ALIGN_BYTES +
+		XSECURE_ECC_P521_SIZE_IN_BYTES];
+	u8 Signature[XSECURE_ECC_P521_SIZE_IN_BYTES +
+		XSECURE_ECDSA_P521_ALIGN_BYTES +
+		XSECURE_ECC_P521_SIZE_IN_BYTES];
+	EcdsaKey Key;
+	EcdsaSign Sign;
+	u32 OffSet = 0U;
+	u32 Size = 0U;
+
+	HashLenTmp = HashInfo->Len;
+	if ((HashInfo->Len > XSECURE_ECC_P521_SIZE_IN_BYTES) ||
+		(HashLenTmp > XSECURE_ECC_P521_SIZE_IN_BYTES)) {
+		Status = (int)XSECURE_ELLIPTIC_INVALID_PARAM;
+		goto END;
+	}
+
+	Status = Xil_SMemSet(PaddedHash, XSECURE_ECC_P521_SIZE_IN_BYTES,
+				0U, XSECURE_ECC_P521_SIZE_IN_BYTES);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	/* Store Pub key(Qx,Qy) and Sign(SignR, SignS) to local buffers */
+	if (CrvType == XSECURE_ECC_NIST_P521) {
+		Size = XSECURE_ECC_P521_SIZE_IN_BYTES;
+		OffSet = Size + XSECURE_ECDSA_P521_ALIGN_BYTES;
+	} else {
+		Size = XSECURE_ECC_P384_SIZE_IN_BYTES;
+		OffSet = Size;
+	}
+	XSecure_PutData(Size, (u8 *)PubKey, KeyAddr->Qx);
+	XSecure_PutData(Size, (u8 *)(PubKey + OffSet), KeyAddr->Qy);
+
+	XSecure_PutData(Size, (u8 *)Signature, SignAddr->SignR);
+	XSecure_PutData(Size, (u8 *)(Signature + OffSet),
+			SignAddr->SignS);
+
+
+	/* Store Hash to local buffer */
+	XSecure_PutData(HashInfo->Len, (u8 *)PaddedHash, HashInfo->Addr);
+
+	Key.Qx = (u8 *)(UINTPTR)PubKey;
+	Key.Qy = (u8 *)(UINTPTR)(PubKey + OffSet);
+
+	Sign.r = (u8 *)(UINTPTR)Signature;
+	Sign.s = (u8 *)(UINTPTR)(Signature + OffSet);
+
+	XSECURE_TEMPORAL_IMPL(VerifyStatus, VerifyStatusTmp, Ecdsa_VerifySign,
+		Crv, PaddedHash, Crv->Bits, (EcdsaKey *)&Key, (EcdsaSign *)&Sign);
+
+	if ((ELLIPTIC_BAD_SIGN == VerifyStatus) ||
+		(ELLIPTIC_BAD_SIGN == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_BAD_SIGN;
+	}
+	else if ((ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN == VerifyStatus) ||
+		(ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN;
+	}
+	else if ((ELLIPTIC_VER_SIGN_R_ZERO == VerifyStatus) ||
+		(ELLIPTIC_VER_SIGN_R_ZERO == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_VER_SIGN_R_ZERO;
+	}
+	else if ((ELLIPTIC_VER_SIGN_S_ZERO == VerifyStatus) ||
+		(ELLIPTIC_VER_SIGN_S_ZERO == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_VER_SIGN_S_ZERO;
+	}
+	else if ((ELLIPTIC_VER_SIGN_R_ORDER_ERROR == VerifyStatus) ||
+		(ELLIPTIC_VER_SIGN_R_ORDER_ERROR == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_VER_SIGN_R_ORDER_ERROR;
+	}
+	else if ((ELLIPTIC_VER_SIGN_S_ORDER_ERROR == VerifyStatus) ||
+		(ELLIPTIC_VER_SIGN_S_ORDER_ERROR == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_VER_SIGN_S_ORDER_ERROR;
+	}
+	else if ((ELLIPTIC_SUCCESS != VerifyStatus) ||
+		(ELLIPTIC_SUCCESS != VerifyStatusTmp)) {
+		Status = XST_FAILURE;
+	}
+	else {
+		Status = XST_SUCCESS;
+	}
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function gets the curve related information
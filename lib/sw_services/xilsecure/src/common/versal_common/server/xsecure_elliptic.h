@@ -106,6 +106,10 @@ int XSecure_EllipticValidateKey_64Bit(XSecure_EllipticCrvTyp CrvType,
 int XSecure_EllipticVerifySign_64Bit(XSecure_EllipticCrvTyp CrvType,
 	XSecure_EllipticHashData *HashInfo, XSecure_EllipticKeyAddr *KeyAddr,
 	XSecure_EllipticSignAddr *SignAddr);
+int XSecure_EllipticVerifySignBatch_64Bit(XSecure_EllipticCrvTyp CrvType,
+	u32 Count, XSecure_EllipticHashData *HashInfo,
+	XSecure_EllipticKeyAddr *KeyAddr, XSecure_EllipticSignAddr *SignAddr,
+	int *VerifyStatus);
 
 #endif
 